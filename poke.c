@@ -2,6 +2,8 @@
 // and otherwise from poking about in a hex editor
 #define _CRT_SECURE_NO_WARNINGS
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <limits.h>
 #include <errno.h>
 #include <string.h>
 #include <stdarg.h>
@@ -11,6 +13,19 @@
 #include <ctype.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
 
 #ifdef _MSC_VER
 #include "mman.h"
@@ -68,36 +83,24 @@ void decode_text(uint8_t *ascii_out, const uint8_t *base, const uint8_t len) {
 	ascii_out[len] = 0;
 }
 
-void dump_trainer_info(const uint8_t *base) {
-	printf("\n\n");
-	uint8_t name[8];
-	decode_text(name, base, 7);
-	printf("%s\n", name);
-
-	bool female = base[0x8] == 0x1;
-	printf("female: %d\n", female);
-
-	uint32_t trainer_id = base[0xA];
-	printf("trainer id %d\n", trainer_id);
-	printf("\n\n");
-}
-
-void dump_game_flags(const uint8_t *base) {
-	enum {
-		FLAG_OFFSET_RS = 0x2a0,
-		FLAG_OFFSET_E = 0x2f0,
-		BADGE_FLAG_RS = 0x807,
-		BADGE_FLAG_E = 0x867
-	};
+enum {
+	DEX_COUNT = 386,
+	DEX_BYTES = 49,
+	DEX_WORDS = 7 // DEX_BYTES rounded up to whole uint64_t
+};
 
-	uint8_t *start = base + FLAG_OFFSET_E;
+// one bit per national dex number, bit 0 of byte 0 is #001
+struct Pokedex {
+	uint64_t owned[DEX_WORDS];
+	uint64_t seen[DEX_WORDS];
+};
 
-	for (int i = 0; i < 8; i++) {
-		uint32_t flag = BADGE_FLAG_E + i;
-		uint8_t val = start[flag >> 3];
-		uint8_t bit = flag & 7;
-		printf("badge %i = %d\n", i, val >> bit & 1);
+uint32_t dex_popcount(const uint64_t *bits) {
+	uint32_t total = 0;
+	for (int i = 0; i < DEX_WORDS; i++) {
+		total += __builtin_popcountll(bits[i]);
 	}
+	return total;
 }
 
 enum poke_type {
@@ -119,6 +122,37 @@ enum poke_type {
 	Dark,
 	Psychic,
 	Egg,
+	TYPE_COUNT
+};
+
+const char *type_names[TYPE_COUNT] = {
+	"Normal", "Water", "Poison", "Fire", "Flying", "Bug", "Electric", "Grass", "Fighting",
+	"Steel", "Rock", "Ghost", "Ground", "Ice", "Dragon", "Dark", "Psychic", "Egg"
+};
+
+// in the order the game keeps them, both in base stats and in party data
+enum stat_index {
+	STAT_HP,
+	STAT_ATTACK,
+	STAT_DEFENSE,
+	STAT_SPEED,
+	STAT_SP_ATTACK,
+	STAT_SP_DEFENSE,
+	STAT_COUNT
+};
+
+const char *stat_names[STAT_COUNT] = {
+	"hp", "attack", "defense", "speed", "sp_attack", "sp_defense"
+};
+
+// in the game's order, so the value matches the species info byte
+enum growth_rate {
+	GROWTH_MEDIUM_FAST,
+	GROWTH_ERRATIC,
+	GROWTH_FLUCTUATING,
+	GROWTH_MEDIUM_SLOW,
+	GROWTH_FAST,
+	GROWTH_SLOW
 };
 
 struct Pokemon {
@@ -126,261 +160,263 @@ struct Pokemon {
 	const char *name;
 	enum poke_type type1;
 	enum poke_type type2;
+	uint8_t base[STAT_COUNT]; // zero for placeholders and eggs. deoxys is its emerald (speed) forme
+	enum growth_rate growth;
 };
 
 const struct Pokemon pokemon_lut[] = {
 	{.hex = 0, .name = "?????????", .type1 = Normal, .type2 = Normal },
-	{.hex = 1, .name = "Bulbasaur", .type1 = Grass, .type2 = Poison },
-	{.hex = 2, .name = "Ivysaur", .type1 = Grass, .type2 = Poison },
-	{.hex = 3, .name = "Venusaur", .type1 = Grass, .type2 = Poison },
-	{.hex = 4, .name = "Charmander", .type1 = Fire, .type2 = Fire },
-	{.hex = 5, .name = "Charmeleon", .type1 = Fire, .type2 = Fire },
-	{.hex = 6, .name = "Charizard", .type1 = Fire, .type2 = Flying },
-	{.hex = 7, .name = "Squirtle", .type1 = Water, .type2 = Water },
-	{.hex = 8, .name = "Wartortle", .type1 = Water, .type2 = Water },
-	{.hex = 9, .name = "Blastoise", .type1 = Water, .type2 = Water },
-	{.hex = 10, .name = "Caterpie", .type1 = Bug, .type2 = Bug },
-	{.hex = 11, .name = "Metapod", .type1 = Bug, .type2 = Bug },
-	{.hex = 12, .name = "Butterfree", .type1 = Bug, .type2 = Flying },
-	{.hex = 13, .name = "Weedle", .type1 = Bug, .type2 = Poison },
-	{.hex = 14, .name = "Kakuna", .type1 = Bug, .type2 = Poison },
-	{.hex = 15, .name = "Beedrill", .type1 = Bug, .type2 = Poison },
-	{.hex = 16, .name = "Pidgey", .type1 = Normal, .type2 = Flying },
-	{.hex = 17, .name = "Pidgeotto", .type1 = Normal, .type2 = Flying },
-	{.hex = 18, .name = "Pidgeot", .type1 = Normal, .type2 = Flying },
-	{.hex = 19, .name = "Rattata", .type1 = Normal, .type2 = Normal },
-	{.hex = 20, .name = "Raticate", .type1 = Normal, .type2 = Normal },
-	{.hex = 21, .name = "Spearow", .type1 = Normal, .type2 = Flying },
-	{.hex = 22, .name = "Fearow", .type1 = Normal, .type2 = Flying },
-	{.hex = 23, .name = "Ekans", .type1 = Poison, .type2 = Poison },
-	{.hex = 24, .name = "Arbok", .type1 = Poison, .type2 = Poison },
-	{.hex = 25, .name = "Pikachu", .type1 = Electric, .type2 = Electric },
-	{.hex = 26, .name = "Raichu", .type1 = Electric, .type2 = Electric },
-	{.hex = 27, .name = "Sandshrew", .type1 = Ground, .type2 = Ground },
-	{.hex = 28, .name = "Sandslash", .type1 = Ground, .type2 = Ground },
-	{.hex = 29, .name = "Nidoran?", .type1 = Poison, .type2 = Poison },
-	{.hex = 30, .name = "Nidorina", .type1 = Poison, .type2 = Poison },
-	{.hex = 31, .name = "Nidoqueen", .type1 = Poison, .type2 = Ground },
-	{.hex = 32, .name = "Nidoran?", .type1 = Poison, .type2 = Poison },
-	{.hex = 33, .name = "Nidorino", .type1 = Poison, .type2 = Poison },
-	{.hex = 34, .name = "Nidoking", .type1 = Poison, .type2 = Ground },
-	{.hex = 35, .name = "Clefairy", .type1 = Normal, .type2 = Normal },
-	{.hex = 36, .name = "Clefable", .type1 = Normal, .type2 = Normal },
-	{.hex = 37, .name = "Vulpix", .type1 = Fire, .type2 = Fire },
-	{.hex = 38, .name = "Ninetales", .type1 = Fire, .type2 = Fire },
-	{.hex = 39, .name = "Jigglypuff", .type1 = Normal, .type2 = Normal },
-	{.hex = 40, .name = "Wigglytuff", .type1 = Normal, .type2 = Normal },
-	{.hex = 41, .name = "Zubat", .type1 = Poison, .type2 = Flying },
-	{.hex = 42, .name = "Golbat", .type1 = Poison, .type2 = Flying },
-	{.hex = 43, .name = "Oddish", .type1 = Grass, .type2 = Poison },
-	{.hex = 44, .name = "Gloom", .type1 = Grass, .type2 = Poison },
-	{.hex = 45, .name = "Vileplume", .type1 = Grass, .type2 = Poison },
-	{.hex = 46, .name = "Paras", .type1 = Bug, .type2 = Grass },
-	{.hex = 47, .name = "Parasect", .type1 = Bug, .type2 = Grass },
-	{.hex = 48, .name = "Venonat", .type1 = Bug, .type2 = Poison },
-	{.hex = 49, .name = "Venomoth", .type1 = Bug, .type2 = Poison },
-	{.hex = 50, .name = "Diglett", .type1 = Ground, .type2 = Ground },
-	{.hex = 51, .name = "Dugtrio", .type1 = Ground, .type2 = Ground },
-	{.hex = 52, .name = "Meowth", .type1 = Normal, .type2 = Normal },
-	{.hex = 53, .name = "Persian", .type1 = Normal, .type2 = Normal },
-	{.hex = 54, .name = "Psyduck", .type1 = Water, .type2 = Water },
-	{.hex = 55, .name = "Golduck", .type1 = Water, .type2 = Water },
-	{.hex = 56, .name = "Mankey", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 57, .name = "Primeape", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 58, .name = "Growlithe", .type1 = Fire, .type2 = Fire },
-	{.hex = 59, .name = "Arcanine", .type1 = Fire, .type2 = Fire },
-	{.hex = 60, .name = "Poliwag", .type1 = Water, .type2 = Water },
-	{.hex = 61, .name = "Poliwhirl", .type1 = Water, .type2 = Water },
-	{.hex = 62, .name = "Poliwrath", .type1 = Water, .type2 = Fighting },
-	{.hex = 63, .name = "Abra", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 64, .name = "Kadabra", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 65, .name = "Alakazam", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 66, .name = "Machop", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 67, .name = "Machoke", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 68, .name = "Machamp", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 69, .name = "Bellsprout", .type1 = Grass, .type2 = Poison },
-	{.hex = 70, .name = "Weepinbell", .type1 = Grass, .type2 = Poison },
-	{.hex = 71, .name = "Victreebel", .type1 = Grass, .type2 = Poison },
-	{.hex = 72, .name = "Tentacool", .type1 = Water, .type2 = Poison },
-	{.hex = 73, .name = "Tentacruel", .type1 = Water, .type2 = Poison },
-	{.hex = 74, .name = "Geodude", .type1 = Rock, .type2 = Ground },
-	{.hex = 75, .name = "Graveler", .type1 = Rock, .type2 = Ground },
-	{.hex = 76, .name = "Golem", .type1 = Rock, .type2 = Ground },
-	{.hex = 77, .name = "Ponyta", .type1 = Fire, .type2 = Fire },
-	{.hex = 78, .name = "Rapidash", .type1 = Fire, .type2 = Fire },
-	{.hex = 79, .name = "Slowpoke", .type1 = Water, .type2 = Psychic },
-	{.hex = 80, .name = "Slowbro", .type1 = Water, .type2 = Psychic },
-	{.hex = 81, .name = "Magnemite", .type1 = Electric, .type2 = Steel },
-	{.hex = 82, .name = "Magneton", .type1 = Electric, .type2 = Steel },
-	{.hex = 83, .name = "Farfetch", .type1 = Normal, .type2 = Flying },
-	{.hex = 84, .name = "Doduo", .type1 = Normal, .type2 = Flying },
-	{.hex = 85, .name = "Dodrio", .type1 = Normal, .type2 = Flying },
-	{.hex = 86, .name = "Seel", .type1 = Water, .type2 = Water },
-	{.hex = 87, .name = "Dewgong", .type1 = Water, .type2 = Ice },
-	{.hex = 88, .name = "Grimer", .type1 = Poison, .type2 = Poison },
-	{.hex = 89, .name = "Muk", .type1 = Poison, .type2 = Poison },
-	{.hex = 90, .name = "Shellder", .type1 = Water, .type2 = Water },
-	{.hex = 91, .name = "Cloyster", .type1 = Water, .type2 = Ice },
-	{.hex = 92, .name = "Gastly", .type1 = Ghost, .type2 = Poison },
-	{.hex = 93, .name = "Haunter", .type1 = Ghost, .type2 = Poison },
-	{.hex = 94, .name = "Gengar", .type1 = Ghost, .type2 = Poison },
-	{.hex = 95, .name = "Onix", .type1 = Rock, .type2 = Ground },
-	{.hex = 96, .name = "Drowzee", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 97, .name = "Hypno", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 98, .name = "Krabby", .type1 = Water, .type2 = Water },
-	{.hex = 99, .name = "Kingler", .type1 = Water, .type2 = Water },
-	{.hex = 100, .name = "Voltorb", .type1 = Electric, .type2 = Electric },
-	{.hex = 101, .name = "Electrode", .type1 = Electric, .type2 = Electric },
-	{.hex = 102, .name = "Exeggcute", .type1 = Grass, .type2 = Psychic },
-	{.hex = 103, .name = "Exeggutor", .type1 = Grass, .type2 = Psychic },
-	{.hex = 104, .name = "Cubone", .type1 = Ground, .type2 = Ground },
-	{.hex = 105, .name = "Marowak", .type1 = Ground, .type2 = Ground },
-	{.hex = 106, .name = "Hitmonlee", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 107, .name = "Hitmonchan", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 108, .name = "Lickitung", .type1 = Normal, .type2 = Normal },
-	{.hex = 109, .name = "Koffing", .type1 = Poison, .type2 = Poison },
-	{.hex = 110, .name = "Weezing", .type1 = Poison, .type2 = Poison },
-	{.hex = 111, .name = "Rhyhorn", .type1 = Ground, .type2 = Rock },
-	{.hex = 112, .name = "Rhydon", .type1 = Ground, .type2 = Rock },
-	{.hex = 113, .name = "Chansey", .type1 = Normal, .type2 = Normal },
-	{.hex = 114, .name = "Tangela", .type1 = Grass, .type2 = Grass },
-	{.hex = 115, .name = "Kangaskhan", .type1 = Normal, .type2 = Normal },
-	{.hex = 116, .name = "Horsea", .type1 = Water, .type2 = Water },
-	{.hex = 117, .name = "Seadra", .type1 = Water, .type2 = Water },
-	{.hex = 118, .name = "Goldeen", .type1 = Water, .type2 = Water },
-	{.hex = 119, .name = "Seaking", .type1 = Water, .type2 = Water },
-	{.hex = 120, .name = "Staryu", .type1 = Water, .type2 = Water },
-	{.hex = 121, .name = "Starmie", .type1 = Water, .type2 = Psychic },
-	{.hex = 122, .name = "Mr. Mime", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 123, .name = "Scyther", .type1 = Bug, .type2 = Flying },
-	{.hex = 124, .name = "Jynx", .type1 = Ice, .type2 = Psychic },
-	{.hex = 125, .name = "Electabuzz", .type1 = Electric, .type2 = Electric },
-	{.hex = 126, .name = "Magmar", .type1 = Fire, .type2 = Fire },
-	{.hex = 127, .name = "Pinsir", .type1 = Bug, .type2 = Bug },
-	{.hex = 128, .name = "Tauros", .type1 = Normal, .type2 = Normal },
-	{.hex = 129, .name = "Magikarp", .type1 = Water, .type2 = Water },
-	{.hex = 130, .name = "Gyarados", .type1 = Water, .type2 = Flying },
-	{.hex = 131, .name = "Lapras", .type1 = Water, .type2 = Ice },
-	{.hex = 132, .name = "Ditto", .type1 = Normal, .type2 = Normal },
-	{.hex = 133, .name = "Eevee", .type1 = Normal, .type2 = Normal },
-	{.hex = 134, .name = "Vaporeon", .type1 = Water, .type2 = Water },
-	{.hex = 135, .name = "Jolteon", .type1 = Electric, .type2 = Electric },
-	{.hex = 136, .name = "Flareon", .type1 = Fire, .type2 = Fire },
-	{.hex = 137, .name = "Porygon", .type1 = Normal, .type2 = Normal },
-	{.hex = 138, .name = "Omanyte", .type1 = Rock, .type2 = Water },
-	{.hex = 139, .name = "Omastar", .type1 = Rock, .type2 = Water },
-	{.hex = 140, .name = "Kabuto", .type1 = Rock, .type2 = Water },
-	{.hex = 141, .name = "Kabutops", .type1 = Rock, .type2 = Water },
-	{.hex = 142, .name = "Aerodactyl", .type1 = Rock, .type2 = Flying },
-	{.hex = 143, .name = "Snorlax", .type1 = Normal, .type2 = Normal },
-	{.hex = 144, .name = "Articuno", .type1 = Ice, .type2 = Flying },
-	{.hex = 145, .name = "Zapdos", .type1 = Electric, .type2 = Flying },
-	{.hex = 146, .name = "Moltres", .type1 = Fire, .type2 = Flying },
-	{.hex = 147, .name = "Dratini", .type1 = Dragon, .type2 = Dragon },
-	{.hex = 148, .name = "Dragonair", .type1 = Dragon, .type2 = Dragon },
-	{.hex = 149, .name = "Dragonite", .type1 = Dragon, .type2 = Flying },
-	{.hex = 150, .name = "Mewtwo", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 151, .name = "Mew", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 152, .name = "Chikorita", .type1 = Grass, .type2 = Grass },
-	{.hex = 153, .name = "Bayleef", .type1 = Grass, .type2 = Grass },
-	{.hex = 154, .name = "Meganium", .type1 = Grass, .type2 = Grass },
-	{.hex = 155, .name = "Cyndaquil", .type1 = Fire, .type2 = Fire },
-	{.hex = 156, .name = "Quilava", .type1 = Fire, .type2 = Fire },
-	{.hex = 157, .name = "Typhlosion", .type1 = Fire, .type2 = Fire },
-	{.hex = 158, .name = "Totodile", .type1 = Water, .type2 = Water },
-	{.hex = 159, .name = "Croconaw", .type1 = Water, .type2 = Water },
-	{.hex = 160, .name = "Feraligatr", .type1 = Water, .type2 = Water },
-	{.hex = 161, .name = "Sentret", .type1 = Normal, .type2 = Normal },
-	{.hex = 162, .name = "Furret", .type1 = Normal, .type2 = Normal },
-	{.hex = 163, .name = "Hoothoot", .type1 = Normal, .type2 = Flying },
-	{.hex = 164, .name = "Noctowl", .type1 = Normal, .type2 = Flying },
-	{.hex = 165, .name = "Ledyba", .type1 = Bug, .type2 = Flying },
-	{.hex = 166, .name = "Ledian", .type1 = Bug, .type2 = Flying },
-	{.hex = 167, .name = "Spinarak", .type1 = Bug, .type2 = Poison },
-	{.hex = 168, .name = "Ariados", .type1 = Bug, .type2 = Poison },
-	{.hex = 169, .name = "Crobat", .type1 = Poison, .type2 = Flying },
-	{.hex = 170, .name = "Chinchou", .type1 = Water, .type2 = Electric },
-	{.hex = 171, .name = "Lanturn", .type1 = Water, .type2 = Electric },
-	{.hex = 172, .name = "Pichu", .type1 = Electric, .type2 = Electric },
-	{.hex = 173, .name = "Cleffa", .type1 = Normal, .type2 = Normal },
-	{.hex = 174, .name = "Igglybuff", .type1 = Normal, .type2 = Normal },
-	{.hex = 175, .name = "Togepi", .type1 = Normal, .type2 = Normal },
-	{.hex = 176, .name = "Togetic", .type1 = Normal, .type2 = Flying },
-	{.hex = 177, .name = "Natu", .type1 = Psychic, .type2 = Flying },
-	{.hex = 178, .name = "Xatu", .type1 = Psychic, .type2 = Flying },
-	{.hex = 179, .name = "Mareep", .type1 = Electric, .type2 = Electric },
-	{.hex = 180, .name = "Flaaffy", .type1 = Electric, .type2 = Electric },
-	{.hex = 181, .name = "Ampharos", .type1 = Electric, .type2 = Electric },
-	{.hex = 182, .name = "Bellossom", .type1 = Grass, .type2 = Grass },
-	{.hex = 183, .name = "Marill", .type1 = Water, .type2 = Water },
-	{.hex = 184, .name = "Azumarill", .type1 = Water, .type2 = Water },
-	{.hex = 185, .name = "Sudowoodo", .type1 = Rock, .type2 = Rock },
-	{.hex = 186, .name = "Politoed", .type1 = Water, .type2 = Water },
-	{.hex = 187, .name = "Hoppip", .type1 = Grass, .type2 = Flying },
-	{.hex = 188, .name = "Skiploom", .type1 = Grass, .type2 = Flying },
-	{.hex = 189, .name = "Jumpluff", .type1 = Grass, .type2 = Flying },
-	{.hex = 190, .name = "Aipom", .type1 = Normal, .type2 = Normal },
-	{.hex = 191, .name = "Sunkern", .type1 = Grass, .type2 = Grass },
-	{.hex = 192, .name = "Sunflora", .type1 = Grass, .type2 = Grass },
-	{.hex = 193, .name = "Yanma", .type1 = Bug, .type2 = Flying },
-	{.hex = 194, .name = "Wooper", .type1 = Water, .type2 = Ground },
-	{.hex = 195, .name = "Quagsire", .type1 = Water, .type2 = Ground },
-	{.hex = 196, .name = "Espeon", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 197, .name = "Umbreon", .type1 = Dark, .type2 = Dark },
-	{.hex = 198, .name = "Murkrow", .type1 = Dark, .type2 = Flying },
-	{.hex = 199, .name = "Slowking", .type1 = Water, .type2 = Psychic },
-	{.hex = 200, .name = "Misdreavus", .type1 = Ghost, .type2 = Ghost },
-	{.hex = 201, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 202, .name = "Wobbuffet", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 203, .name = "Girafarig", .type1 = Normal, .type2 = Psychic },
-	{.hex = 204, .name = "Pineco", .type1 = Bug, .type2 = Bug },
-	{.hex = 205, .name = "Forretress", .type1 = Bug, .type2 = Steel },
-	{.hex = 206, .name = "Dunsparce", .type1 = Normal, .type2 = Normal },
-	{.hex = 207, .name = "Gligar", .type1 = Ground, .type2 = Flying },
-	{.hex = 208, .name = "Steelix", .type1 = Steel, .type2 = Ground },
-	{.hex = 209, .name = "Snubbull", .type1 = Normal, .type2 = Normal },
-	{.hex = 210, .name = "Granbull", .type1 = Normal, .type2 = Normal },
-	{.hex = 211, .name = "Qwilfish", .type1 = Water, .type2 = Poison },
-	{.hex = 212, .name = "Scizor", .type1 = Bug, .type2 = Steel },
-	{.hex = 213, .name = "Shuckle", .type1 = Bug, .type2 = Rock },
-	{.hex = 214, .name = "Heracross", .type1 = Bug, .type2 = Fighting },
-	{.hex = 215, .name = "Sneasel", .type1 = Dark, .type2 = Ice },
-	{.hex = 216, .name = "Teddiursa", .type1 = Normal, .type2 = Normal },
-	{.hex = 217, .name = "Ursaring", .type1 = Normal, .type2 = Normal },
-	{.hex = 218, .name = "Slugma", .type1 = Fire, .type2 = Fire },
-	{.hex = 219, .name = "Magcargo", .type1 = Fire, .type2 = Rock },
-	{.hex = 220, .name = "Swinub", .type1 = Ice, .type2 = Ground },
-	{.hex = 221, .name = "Piloswine", .type1 = Ice, .type2 = Ground },
-	{.hex = 222, .name = "Corsola", .type1 = Water, .type2 = Rock },
-	{.hex = 223, .name = "Remoraid", .type1 = Water, .type2 = Water },
-	{.hex = 224, .name = "Octillery", .type1 = Water, .type2 = Water },
-	{.hex = 225, .name = "Delibird", .type1 = Ice, .type2 = Flying },
-	{.hex = 226, .name = "Mantine", .type1 = Water, .type2 = Flying },
-	{.hex = 227, .name = "Skarmory", .type1 = Steel, .type2 = Flying },
-	{.hex = 228, .name = "Houndour", .type1 = Dark, .type2 = Fire },
-	{.hex = 229, .name = "Houndoom", .type1 = Dark, .type2 = Fire },
-	{.hex = 230, .name = "Kingdra", .type1 = Water, .type2 = Dragon },
-	{.hex = 231, .name = "Phanpy", .type1 = Ground, .type2 = Ground },
-	{.hex = 232, .name = "Donphan", .type1 = Ground, .type2 = Ground },
-	{.hex = 233, .name = "Porygon2", .type1 = Normal, .type2 = Normal },
-	{.hex = 234, .name = "Stantler", .type1 = Normal, .type2 = Normal },
-	{.hex = 235, .name = "Smeargle", .type1 = Normal, .type2 = Normal },
-	{.hex = 236, .name = "Tyrogue", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 237, .name = "Hitmontop", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 238, .name = "Smoochum", .type1 = Ice, .type2 = Psychic },
-	{.hex = 239, .name = "Elekid", .type1 = Electric, .type2 = Electric },
-	{.hex = 240, .name = "Magby", .type1 = Fire, .type2 = Fire },
-	{.hex = 241, .name = "Miltank", .type1 = Normal, .type2 = Normal },
-	{.hex = 242, .name = "Blissey", .type1 = Normal, .type2 = Normal },
-	{.hex = 243, .name = "Raikou", .type1 = Electric, .type2 = Electric },
-	{.hex = 244, .name = "Entei", .type1 = Fire, .type2 = Fire },
-	{.hex = 245, .name = "Suicune", .type1 = Water, .type2 = Water },
-	{.hex = 246, .name = "Larvitar", .type1 = Rock, .type2 = Ground },
-	{.hex = 247, .name = "Pupitar", .type1 = Rock, .type2 = Ground },
-	{.hex = 248, .name = "Tyranitar", .type1 = Rock, .type2 = Dark },
-	{.hex = 249, .name = "Lugia", .type1 = Psychic, .type2 = Flying },
-	{.hex = 250, .name = "Ho-Oh", .type1 = Fire, .type2 = Flying },
-	{.hex = 251, .name = "Celebi", .type1 = Psychic, .type2 = Grass },
+	{.hex = 1, .name = "Bulbasaur", .type1 = Grass, .type2 = Poison, .base = { 45, 49, 49, 45, 65, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 2, .name = "Ivysaur", .type1 = Grass, .type2 = Poison, .base = { 60, 62, 63, 60, 80, 80 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 3, .name = "Venusaur", .type1 = Grass, .type2 = Poison, .base = { 80, 82, 83, 80, 100, 100 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 4, .name = "Charmander", .type1 = Fire, .type2 = Fire, .base = { 39, 52, 43, 65, 60, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 5, .name = "Charmeleon", .type1 = Fire, .type2 = Fire, .base = { 58, 64, 58, 80, 80, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 6, .name = "Charizard", .type1 = Fire, .type2 = Flying, .base = { 78, 84, 78, 100, 109, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 7, .name = "Squirtle", .type1 = Water, .type2 = Water, .base = { 44, 48, 65, 43, 50, 64 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 8, .name = "Wartortle", .type1 = Water, .type2 = Water, .base = { 59, 63, 80, 58, 65, 80 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 9, .name = "Blastoise", .type1 = Water, .type2 = Water, .base = { 79, 83, 100, 78, 85, 105 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 10, .name = "Caterpie", .type1 = Bug, .type2 = Bug, .base = { 45, 30, 35, 45, 20, 20 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 11, .name = "Metapod", .type1 = Bug, .type2 = Bug, .base = { 50, 20, 55, 30, 25, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 12, .name = "Butterfree", .type1 = Bug, .type2 = Flying, .base = { 60, 45, 50, 70, 80, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 13, .name = "Weedle", .type1 = Bug, .type2 = Poison, .base = { 40, 35, 30, 50, 20, 20 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 14, .name = "Kakuna", .type1 = Bug, .type2 = Poison, .base = { 45, 25, 50, 35, 25, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 15, .name = "Beedrill", .type1 = Bug, .type2 = Poison, .base = { 65, 80, 40, 75, 45, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 16, .name = "Pidgey", .type1 = Normal, .type2 = Flying, .base = { 40, 45, 40, 56, 35, 35 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 17, .name = "Pidgeotto", .type1 = Normal, .type2 = Flying, .base = { 63, 60, 55, 71, 50, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 18, .name = "Pidgeot", .type1 = Normal, .type2 = Flying, .base = { 83, 80, 75, 91, 70, 70 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 19, .name = "Rattata", .type1 = Normal, .type2 = Normal, .base = { 30, 56, 35, 72, 25, 35 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 20, .name = "Raticate", .type1 = Normal, .type2 = Normal, .base = { 55, 81, 60, 97, 50, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 21, .name = "Spearow", .type1 = Normal, .type2 = Flying, .base = { 40, 60, 30, 70, 31, 31 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 22, .name = "Fearow", .type1 = Normal, .type2 = Flying, .base = { 65, 90, 65, 100, 61, 61 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 23, .name = "Ekans", .type1 = Poison, .type2 = Poison, .base = { 35, 60, 44, 55, 40, 54 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 24, .name = "Arbok", .type1 = Poison, .type2 = Poison, .base = { 60, 85, 69, 80, 65, 79 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 25, .name = "Pikachu", .type1 = Electric, .type2 = Electric, .base = { 35, 55, 30, 90, 50, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 26, .name = "Raichu", .type1 = Electric, .type2 = Electric, .base = { 60, 90, 55, 100, 90, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 27, .name = "Sandshrew", .type1 = Ground, .type2 = Ground, .base = { 50, 75, 85, 40, 20, 30 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 28, .name = "Sandslash", .type1 = Ground, .type2 = Ground, .base = { 75, 100, 110, 65, 45, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 29, .name = "Nidoran?", .type1 = Poison, .type2 = Poison, .base = { 55, 47, 52, 41, 40, 40 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 30, .name = "Nidorina", .type1 = Poison, .type2 = Poison, .base = { 70, 62, 67, 56, 55, 55 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 31, .name = "Nidoqueen", .type1 = Poison, .type2 = Ground, .base = { 90, 82, 87, 76, 75, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 32, .name = "Nidoran?", .type1 = Poison, .type2 = Poison, .base = { 46, 57, 40, 50, 40, 40 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 33, .name = "Nidorino", .type1 = Poison, .type2 = Poison, .base = { 61, 72, 57, 65, 55, 55 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 34, .name = "Nidoking", .type1 = Poison, .type2 = Ground, .base = { 81, 92, 77, 85, 85, 75 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 35, .name = "Clefairy", .type1 = Normal, .type2 = Normal, .base = { 70, 45, 48, 35, 60, 65 }, .growth = GROWTH_FAST },
+	{.hex = 36, .name = "Clefable", .type1 = Normal, .type2 = Normal, .base = { 95, 70, 73, 60, 85, 90 }, .growth = GROWTH_FAST },
+	{.hex = 37, .name = "Vulpix", .type1 = Fire, .type2 = Fire, .base = { 38, 41, 40, 65, 50, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 38, .name = "Ninetales", .type1 = Fire, .type2 = Fire, .base = { 73, 76, 75, 100, 81, 100 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 39, .name = "Jigglypuff", .type1 = Normal, .type2 = Normal, .base = { 115, 45, 20, 20, 45, 25 }, .growth = GROWTH_FAST },
+	{.hex = 40, .name = "Wigglytuff", .type1 = Normal, .type2 = Normal, .base = { 140, 70, 45, 45, 75, 50 }, .growth = GROWTH_FAST },
+	{.hex = 41, .name = "Zubat", .type1 = Poison, .type2 = Flying, .base = { 40, 45, 35, 55, 30, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 42, .name = "Golbat", .type1 = Poison, .type2 = Flying, .base = { 75, 80, 70, 90, 65, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 43, .name = "Oddish", .type1 = Grass, .type2 = Poison, .base = { 45, 50, 55, 30, 75, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 44, .name = "Gloom", .type1 = Grass, .type2 = Poison, .base = { 60, 65, 70, 40, 85, 75 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 45, .name = "Vileplume", .type1 = Grass, .type2 = Poison, .base = { 75, 80, 85, 50, 100, 90 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 46, .name = "Paras", .type1 = Bug, .type2 = Grass, .base = { 35, 70, 55, 25, 45, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 47, .name = "Parasect", .type1 = Bug, .type2 = Grass, .base = { 60, 95, 80, 30, 60, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 48, .name = "Venonat", .type1 = Bug, .type2 = Poison, .base = { 60, 55, 50, 45, 40, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 49, .name = "Venomoth", .type1 = Bug, .type2 = Poison, .base = { 70, 65, 60, 90, 90, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 50, .name = "Diglett", .type1 = Ground, .type2 = Ground, .base = { 10, 55, 25, 95, 35, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 51, .name = "Dugtrio", .type1 = Ground, .type2 = Ground, .base = { 35, 80, 50, 120, 50, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 52, .name = "Meowth", .type1 = Normal, .type2 = Normal, .base = { 40, 45, 35, 90, 40, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 53, .name = "Persian", .type1 = Normal, .type2 = Normal, .base = { 65, 70, 60, 115, 65, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 54, .name = "Psyduck", .type1 = Water, .type2 = Water, .base = { 50, 52, 48, 55, 65, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 55, .name = "Golduck", .type1 = Water, .type2 = Water, .base = { 80, 82, 78, 85, 95, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 56, .name = "Mankey", .type1 = Fighting, .type2 = Fighting, .base = { 40, 80, 35, 70, 35, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 57, .name = "Primeape", .type1 = Fighting, .type2 = Fighting, .base = { 65, 105, 60, 95, 60, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 58, .name = "Growlithe", .type1 = Fire, .type2 = Fire, .base = { 55, 70, 45, 60, 70, 50 }, .growth = GROWTH_SLOW },
+	{.hex = 59, .name = "Arcanine", .type1 = Fire, .type2 = Fire, .base = { 90, 110, 80, 95, 100, 80 }, .growth = GROWTH_SLOW },
+	{.hex = 60, .name = "Poliwag", .type1 = Water, .type2 = Water, .base = { 40, 50, 40, 90, 40, 40 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 61, .name = "Poliwhirl", .type1 = Water, .type2 = Water, .base = { 65, 65, 65, 90, 50, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 62, .name = "Poliwrath", .type1 = Water, .type2 = Fighting, .base = { 90, 85, 95, 70, 70, 90 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 63, .name = "Abra", .type1 = Psychic, .type2 = Psychic, .base = { 25, 20, 15, 90, 105, 55 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 64, .name = "Kadabra", .type1 = Psychic, .type2 = Psychic, .base = { 40, 35, 30, 105, 120, 70 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 65, .name = "Alakazam", .type1 = Psychic, .type2 = Psychic, .base = { 55, 50, 45, 120, 135, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 66, .name = "Machop", .type1 = Fighting, .type2 = Fighting, .base = { 70, 80, 50, 35, 35, 35 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 67, .name = "Machoke", .type1 = Fighting, .type2 = Fighting, .base = { 80, 100, 70, 45, 50, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 68, .name = "Machamp", .type1 = Fighting, .type2 = Fighting, .base = { 90, 130, 80, 55, 65, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 69, .name = "Bellsprout", .type1 = Grass, .type2 = Poison, .base = { 50, 75, 35, 40, 70, 30 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 70, .name = "Weepinbell", .type1 = Grass, .type2 = Poison, .base = { 65, 90, 50, 55, 85, 45 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 71, .name = "Victreebel", .type1 = Grass, .type2 = Poison, .base = { 80, 105, 65, 70, 100, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 72, .name = "Tentacool", .type1 = Water, .type2 = Poison, .base = { 40, 40, 35, 70, 50, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 73, .name = "Tentacruel", .type1 = Water, .type2 = Poison, .base = { 80, 70, 65, 100, 80, 120 }, .growth = GROWTH_SLOW },
+	{.hex = 74, .name = "Geodude", .type1 = Rock, .type2 = Ground, .base = { 40, 80, 100, 20, 30, 30 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 75, .name = "Graveler", .type1 = Rock, .type2 = Ground, .base = { 55, 95, 115, 35, 45, 45 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 76, .name = "Golem", .type1 = Rock, .type2 = Ground, .base = { 80, 110, 130, 45, 55, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 77, .name = "Ponyta", .type1 = Fire, .type2 = Fire, .base = { 50, 85, 55, 90, 65, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 78, .name = "Rapidash", .type1 = Fire, .type2 = Fire, .base = { 65, 100, 70, 105, 80, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 79, .name = "Slowpoke", .type1 = Water, .type2 = Psychic, .base = { 90, 65, 65, 15, 40, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 80, .name = "Slowbro", .type1 = Water, .type2 = Psychic, .base = { 95, 75, 110, 30, 100, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 81, .name = "Magnemite", .type1 = Electric, .type2 = Steel, .base = { 25, 35, 70, 45, 95, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 82, .name = "Magneton", .type1 = Electric, .type2 = Steel, .base = { 50, 60, 95, 70, 120, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 83, .name = "Farfetch", .type1 = Normal, .type2 = Flying, .base = { 52, 65, 55, 60, 58, 62 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 84, .name = "Doduo", .type1 = Normal, .type2 = Flying, .base = { 35, 85, 45, 75, 35, 35 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 85, .name = "Dodrio", .type1 = Normal, .type2 = Flying, .base = { 60, 110, 70, 100, 60, 60 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 86, .name = "Seel", .type1 = Water, .type2 = Water, .base = { 65, 45, 55, 45, 45, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 87, .name = "Dewgong", .type1 = Water, .type2 = Ice, .base = { 90, 70, 80, 70, 70, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 88, .name = "Grimer", .type1 = Poison, .type2 = Poison, .base = { 80, 80, 50, 25, 40, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 89, .name = "Muk", .type1 = Poison, .type2 = Poison, .base = { 105, 105, 75, 50, 65, 100 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 90, .name = "Shellder", .type1 = Water, .type2 = Water, .base = { 30, 65, 100, 40, 45, 25 }, .growth = GROWTH_SLOW },
+	{.hex = 91, .name = "Cloyster", .type1 = Water, .type2 = Ice, .base = { 50, 95, 180, 70, 85, 45 }, .growth = GROWTH_SLOW },
+	{.hex = 92, .name = "Gastly", .type1 = Ghost, .type2 = Poison, .base = { 30, 35, 30, 80, 100, 35 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 93, .name = "Haunter", .type1 = Ghost, .type2 = Poison, .base = { 45, 50, 45, 95, 115, 55 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 94, .name = "Gengar", .type1 = Ghost, .type2 = Poison, .base = { 60, 65, 60, 110, 130, 75 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 95, .name = "Onix", .type1 = Rock, .type2 = Ground, .base = { 35, 45, 160, 70, 30, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 96, .name = "Drowzee", .type1 = Psychic, .type2 = Psychic, .base = { 60, 48, 45, 42, 43, 90 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 97, .name = "Hypno", .type1 = Psychic, .type2 = Psychic, .base = { 85, 73, 70, 67, 73, 115 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 98, .name = "Krabby", .type1 = Water, .type2 = Water, .base = { 30, 105, 90, 50, 25, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 99, .name = "Kingler", .type1 = Water, .type2 = Water, .base = { 55, 130, 115, 75, 50, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 100, .name = "Voltorb", .type1 = Electric, .type2 = Electric, .base = { 40, 30, 50, 100, 55, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 101, .name = "Electrode", .type1 = Electric, .type2 = Electric, .base = { 60, 50, 70, 140, 80, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 102, .name = "Exeggcute", .type1 = Grass, .type2 = Psychic, .base = { 60, 40, 80, 40, 60, 45 }, .growth = GROWTH_SLOW },
+	{.hex = 103, .name = "Exeggutor", .type1 = Grass, .type2 = Psychic, .base = { 95, 95, 85, 55, 125, 65 }, .growth = GROWTH_SLOW },
+	{.hex = 104, .name = "Cubone", .type1 = Ground, .type2 = Ground, .base = { 50, 50, 95, 35, 40, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 105, .name = "Marowak", .type1 = Ground, .type2 = Ground, .base = { 60, 80, 110, 45, 50, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 106, .name = "Hitmonlee", .type1 = Fighting, .type2 = Fighting, .base = { 50, 120, 53, 87, 35, 110 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 107, .name = "Hitmonchan", .type1 = Fighting, .type2 = Fighting, .base = { 50, 105, 79, 76, 35, 110 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 108, .name = "Lickitung", .type1 = Normal, .type2 = Normal, .base = { 90, 55, 75, 30, 60, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 109, .name = "Koffing", .type1 = Poison, .type2 = Poison, .base = { 40, 65, 95, 35, 60, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 110, .name = "Weezing", .type1 = Poison, .type2 = Poison, .base = { 65, 90, 120, 60, 85, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 111, .name = "Rhyhorn", .type1 = Ground, .type2 = Rock, .base = { 80, 85, 95, 25, 30, 30 }, .growth = GROWTH_SLOW },
+	{.hex = 112, .name = "Rhydon", .type1 = Ground, .type2 = Rock, .base = { 105, 130, 120, 40, 45, 45 }, .growth = GROWTH_SLOW },
+	{.hex = 113, .name = "Chansey", .type1 = Normal, .type2 = Normal, .base = { 250, 5, 5, 50, 35, 105 }, .growth = GROWTH_FAST },
+	{.hex = 114, .name = "Tangela", .type1 = Grass, .type2 = Grass, .base = { 65, 55, 115, 60, 100, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 115, .name = "Kangaskhan", .type1 = Normal, .type2 = Normal, .base = { 105, 95, 80, 90, 40, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 116, .name = "Horsea", .type1 = Water, .type2 = Water, .base = { 30, 40, 70, 60, 70, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 117, .name = "Seadra", .type1 = Water, .type2 = Water, .base = { 55, 65, 95, 85, 95, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 118, .name = "Goldeen", .type1 = Water, .type2 = Water, .base = { 45, 67, 60, 63, 35, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 119, .name = "Seaking", .type1 = Water, .type2 = Water, .base = { 80, 92, 65, 68, 65, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 120, .name = "Staryu", .type1 = Water, .type2 = Water, .base = { 30, 45, 55, 85, 70, 55 }, .growth = GROWTH_SLOW },
+	{.hex = 121, .name = "Starmie", .type1 = Water, .type2 = Psychic, .base = { 60, 75, 85, 115, 100, 85 }, .growth = GROWTH_SLOW },
+	{.hex = 122, .name = "Mr. Mime", .type1 = Psychic, .type2 = Psychic, .base = { 40, 45, 65, 90, 100, 120 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 123, .name = "Scyther", .type1 = Bug, .type2 = Flying, .base = { 70, 110, 80, 105, 55, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 124, .name = "Jynx", .type1 = Ice, .type2 = Psychic, .base = { 65, 50, 35, 95, 115, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 125, .name = "Electabuzz", .type1 = Electric, .type2 = Electric, .base = { 65, 83, 57, 105, 95, 85 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 126, .name = "Magmar", .type1 = Fire, .type2 = Fire, .base = { 65, 95, 57, 93, 100, 85 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 127, .name = "Pinsir", .type1 = Bug, .type2 = Bug, .base = { 65, 125, 100, 85, 55, 70 }, .growth = GROWTH_SLOW },
+	{.hex = 128, .name = "Tauros", .type1 = Normal, .type2 = Normal, .base = { 75, 100, 95, 110, 40, 70 }, .growth = GROWTH_SLOW },
+	{.hex = 129, .name = "Magikarp", .type1 = Water, .type2 = Water, .base = { 20, 10, 55, 80, 15, 20 }, .growth = GROWTH_SLOW },
+	{.hex = 130, .name = "Gyarados", .type1 = Water, .type2 = Flying, .base = { 95, 125, 79, 81, 60, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 131, .name = "Lapras", .type1 = Water, .type2 = Ice, .base = { 130, 85, 80, 60, 85, 95 }, .growth = GROWTH_SLOW },
+	{.hex = 132, .name = "Ditto", .type1 = Normal, .type2 = Normal, .base = { 48, 48, 48, 48, 48, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 133, .name = "Eevee", .type1 = Normal, .type2 = Normal, .base = { 55, 55, 50, 55, 45, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 134, .name = "Vaporeon", .type1 = Water, .type2 = Water, .base = { 130, 65, 60, 65, 110, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 135, .name = "Jolteon", .type1 = Electric, .type2 = Electric, .base = { 65, 65, 60, 130, 110, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 136, .name = "Flareon", .type1 = Fire, .type2 = Fire, .base = { 65, 130, 60, 65, 95, 110 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 137, .name = "Porygon", .type1 = Normal, .type2 = Normal, .base = { 65, 60, 70, 40, 85, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 138, .name = "Omanyte", .type1 = Rock, .type2 = Water, .base = { 35, 40, 100, 35, 90, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 139, .name = "Omastar", .type1 = Rock, .type2 = Water, .base = { 70, 60, 125, 55, 115, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 140, .name = "Kabuto", .type1 = Rock, .type2 = Water, .base = { 30, 80, 90, 55, 55, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 141, .name = "Kabutops", .type1 = Rock, .type2 = Water, .base = { 60, 115, 105, 80, 65, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 142, .name = "Aerodactyl", .type1 = Rock, .type2 = Flying, .base = { 80, 105, 65, 130, 60, 75 }, .growth = GROWTH_SLOW },
+	{.hex = 143, .name = "Snorlax", .type1 = Normal, .type2 = Normal, .base = { 160, 110, 65, 30, 65, 110 }, .growth = GROWTH_SLOW },
+	{.hex = 144, .name = "Articuno", .type1 = Ice, .type2 = Flying, .base = { 90, 85, 100, 85, 95, 125 }, .growth = GROWTH_SLOW },
+	{.hex = 145, .name = "Zapdos", .type1 = Electric, .type2 = Flying, .base = { 90, 90, 85, 100, 125, 90 }, .growth = GROWTH_SLOW },
+	{.hex = 146, .name = "Moltres", .type1 = Fire, .type2 = Flying, .base = { 90, 100, 90, 90, 125, 85 }, .growth = GROWTH_SLOW },
+	{.hex = 147, .name = "Dratini", .type1 = Dragon, .type2 = Dragon, .base = { 41, 64, 45, 50, 50, 50 }, .growth = GROWTH_SLOW },
+	{.hex = 148, .name = "Dragonair", .type1 = Dragon, .type2 = Dragon, .base = { 61, 84, 65, 70, 70, 70 }, .growth = GROWTH_SLOW },
+	{.hex = 149, .name = "Dragonite", .type1 = Dragon, .type2 = Flying, .base = { 91, 134, 95, 80, 100, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 150, .name = "Mewtwo", .type1 = Psychic, .type2 = Psychic, .base = { 106, 110, 90, 130, 154, 90 }, .growth = GROWTH_SLOW },
+	{.hex = 151, .name = "Mew", .type1 = Psychic, .type2 = Psychic, .base = { 100, 100, 100, 100, 100, 100 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 152, .name = "Chikorita", .type1 = Grass, .type2 = Grass, .base = { 45, 49, 65, 45, 49, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 153, .name = "Bayleef", .type1 = Grass, .type2 = Grass, .base = { 60, 62, 80, 60, 63, 80 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 154, .name = "Meganium", .type1 = Grass, .type2 = Grass, .base = { 80, 82, 100, 80, 83, 100 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 155, .name = "Cyndaquil", .type1 = Fire, .type2 = Fire, .base = { 39, 52, 43, 65, 60, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 156, .name = "Quilava", .type1 = Fire, .type2 = Fire, .base = { 58, 64, 58, 80, 80, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 157, .name = "Typhlosion", .type1 = Fire, .type2 = Fire, .base = { 78, 84, 78, 100, 109, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 158, .name = "Totodile", .type1 = Water, .type2 = Water, .base = { 50, 65, 64, 43, 44, 48 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 159, .name = "Croconaw", .type1 = Water, .type2 = Water, .base = { 65, 80, 80, 58, 59, 63 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 160, .name = "Feraligatr", .type1 = Water, .type2 = Water, .base = { 85, 105, 100, 78, 79, 83 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 161, .name = "Sentret", .type1 = Normal, .type2 = Normal, .base = { 35, 46, 34, 20, 35, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 162, .name = "Furret", .type1 = Normal, .type2 = Normal, .base = { 85, 76, 64, 90, 45, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 163, .name = "Hoothoot", .type1 = Normal, .type2 = Flying, .base = { 60, 30, 30, 50, 36, 56 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 164, .name = "Noctowl", .type1 = Normal, .type2 = Flying, .base = { 100, 50, 50, 70, 76, 96 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 165, .name = "Ledyba", .type1 = Bug, .type2 = Flying, .base = { 40, 20, 30, 55, 40, 80 }, .growth = GROWTH_FAST },
+	{.hex = 166, .name = "Ledian", .type1 = Bug, .type2 = Flying, .base = { 55, 35, 50, 85, 55, 110 }, .growth = GROWTH_FAST },
+	{.hex = 167, .name = "Spinarak", .type1 = Bug, .type2 = Poison, .base = { 40, 60, 40, 30, 40, 40 }, .growth = GROWTH_FAST },
+	{.hex = 168, .name = "Ariados", .type1 = Bug, .type2 = Poison, .base = { 70, 90, 70, 40, 60, 60 }, .growth = GROWTH_FAST },
+	{.hex = 169, .name = "Crobat", .type1 = Poison, .type2 = Flying, .base = { 85, 90, 80, 130, 70, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 170, .name = "Chinchou", .type1 = Water, .type2 = Electric, .base = { 75, 38, 38, 67, 56, 56 }, .growth = GROWTH_SLOW },
+	{.hex = 171, .name = "Lanturn", .type1 = Water, .type2 = Electric, .base = { 125, 58, 58, 67, 76, 76 }, .growth = GROWTH_SLOW },
+	{.hex = 172, .name = "Pichu", .type1 = Electric, .type2 = Electric, .base = { 20, 40, 15, 60, 35, 35 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 173, .name = "Cleffa", .type1 = Normal, .type2 = Normal, .base = { 50, 25, 28, 15, 45, 55 }, .growth = GROWTH_FAST },
+	{.hex = 174, .name = "Igglybuff", .type1 = Normal, .type2 = Normal, .base = { 90, 30, 15, 15, 40, 20 }, .growth = GROWTH_FAST },
+	{.hex = 175, .name = "Togepi", .type1 = Normal, .type2 = Normal, .base = { 35, 20, 65, 20, 40, 65 }, .growth = GROWTH_FAST },
+	{.hex = 176, .name = "Togetic", .type1 = Normal, .type2 = Flying, .base = { 55, 40, 85, 40, 80, 105 }, .growth = GROWTH_FAST },
+	{.hex = 177, .name = "Natu", .type1 = Psychic, .type2 = Flying, .base = { 40, 50, 45, 70, 70, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 178, .name = "Xatu", .type1 = Psychic, .type2 = Flying, .base = { 65, 75, 70, 95, 95, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 179, .name = "Mareep", .type1 = Electric, .type2 = Electric, .base = { 55, 40, 40, 35, 65, 45 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 180, .name = "Flaaffy", .type1 = Electric, .type2 = Electric, .base = { 70, 55, 55, 45, 80, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 181, .name = "Ampharos", .type1 = Electric, .type2 = Electric, .base = { 90, 75, 75, 55, 115, 90 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 182, .name = "Bellossom", .type1 = Grass, .type2 = Grass, .base = { 75, 80, 85, 50, 90, 100 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 183, .name = "Marill", .type1 = Water, .type2 = Water, .base = { 70, 20, 50, 40, 20, 50 }, .growth = GROWTH_FAST },
+	{.hex = 184, .name = "Azumarill", .type1 = Water, .type2 = Water, .base = { 100, 50, 80, 50, 50, 80 }, .growth = GROWTH_FAST },
+	{.hex = 185, .name = "Sudowoodo", .type1 = Rock, .type2 = Rock, .base = { 70, 100, 115, 30, 30, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 186, .name = "Politoed", .type1 = Water, .type2 = Water, .base = { 90, 75, 75, 70, 90, 100 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 187, .name = "Hoppip", .type1 = Grass, .type2 = Flying, .base = { 35, 35, 40, 50, 35, 55 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 188, .name = "Skiploom", .type1 = Grass, .type2 = Flying, .base = { 55, 45, 50, 80, 45, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 189, .name = "Jumpluff", .type1 = Grass, .type2 = Flying, .base = { 75, 55, 70, 110, 55, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 190, .name = "Aipom", .type1 = Normal, .type2 = Normal, .base = { 55, 70, 55, 85, 40, 55 }, .growth = GROWTH_FAST },
+	{.hex = 191, .name = "Sunkern", .type1 = Grass, .type2 = Grass, .base = { 30, 30, 30, 30, 30, 30 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 192, .name = "Sunflora", .type1 = Grass, .type2 = Grass, .base = { 75, 75, 55, 30, 105, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 193, .name = "Yanma", .type1 = Bug, .type2 = Flying, .base = { 65, 65, 45, 95, 75, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 194, .name = "Wooper", .type1 = Water, .type2 = Ground, .base = { 55, 45, 45, 15, 25, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 195, .name = "Quagsire", .type1 = Water, .type2 = Ground, .base = { 95, 85, 85, 35, 65, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 196, .name = "Espeon", .type1 = Psychic, .type2 = Psychic, .base = { 65, 65, 60, 110, 130, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 197, .name = "Umbreon", .type1 = Dark, .type2 = Dark, .base = { 95, 65, 110, 65, 60, 130 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 198, .name = "Murkrow", .type1 = Dark, .type2 = Flying, .base = { 60, 85, 42, 91, 85, 42 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 199, .name = "Slowking", .type1 = Water, .type2 = Psychic, .base = { 95, 75, 80, 30, 100, 110 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 200, .name = "Misdreavus", .type1 = Ghost, .type2 = Ghost, .base = { 60, 60, 60, 85, 85, 85 }, .growth = GROWTH_FAST },
+	{.hex = 201, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 202, .name = "Wobbuffet", .type1 = Psychic, .type2 = Psychic, .base = { 190, 33, 58, 33, 33, 58 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 203, .name = "Girafarig", .type1 = Normal, .type2 = Psychic, .base = { 70, 80, 65, 85, 90, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 204, .name = "Pineco", .type1 = Bug, .type2 = Bug, .base = { 50, 65, 90, 15, 35, 35 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 205, .name = "Forretress", .type1 = Bug, .type2 = Steel, .base = { 75, 90, 140, 40, 60, 60 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 206, .name = "Dunsparce", .type1 = Normal, .type2 = Normal, .base = { 100, 70, 70, 45, 65, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 207, .name = "Gligar", .type1 = Ground, .type2 = Flying, .base = { 65, 75, 105, 85, 35, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 208, .name = "Steelix", .type1 = Steel, .type2 = Ground, .base = { 75, 85, 200, 30, 55, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 209, .name = "Snubbull", .type1 = Normal, .type2 = Normal, .base = { 60, 80, 50, 30, 40, 40 }, .growth = GROWTH_FAST },
+	{.hex = 210, .name = "Granbull", .type1 = Normal, .type2 = Normal, .base = { 90, 120, 75, 45, 60, 60 }, .growth = GROWTH_FAST },
+	{.hex = 211, .name = "Qwilfish", .type1 = Water, .type2 = Poison, .base = { 65, 95, 75, 85, 55, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 212, .name = "Scizor", .type1 = Bug, .type2 = Steel, .base = { 70, 130, 100, 65, 55, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 213, .name = "Shuckle", .type1 = Bug, .type2 = Rock, .base = { 20, 10, 230, 5, 10, 230 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 214, .name = "Heracross", .type1 = Bug, .type2 = Fighting, .base = { 80, 125, 75, 85, 40, 95 }, .growth = GROWTH_SLOW },
+	{.hex = 215, .name = "Sneasel", .type1 = Dark, .type2 = Ice, .base = { 55, 95, 55, 115, 35, 75 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 216, .name = "Teddiursa", .type1 = Normal, .type2 = Normal, .base = { 60, 80, 50, 40, 50, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 217, .name = "Ursaring", .type1 = Normal, .type2 = Normal, .base = { 90, 130, 75, 55, 75, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 218, .name = "Slugma", .type1 = Fire, .type2 = Fire, .base = { 40, 40, 40, 20, 70, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 219, .name = "Magcargo", .type1 = Fire, .type2 = Rock, .base = { 50, 50, 120, 30, 80, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 220, .name = "Swinub", .type1 = Ice, .type2 = Ground, .base = { 50, 50, 40, 50, 30, 30 }, .growth = GROWTH_SLOW },
+	{.hex = 221, .name = "Piloswine", .type1 = Ice, .type2 = Ground, .base = { 100, 100, 80, 50, 60, 60 }, .growth = GROWTH_SLOW },
+	{.hex = 222, .name = "Corsola", .type1 = Water, .type2 = Rock, .base = { 55, 55, 85, 35, 65, 85 }, .growth = GROWTH_FAST },
+	{.hex = 223, .name = "Remoraid", .type1 = Water, .type2 = Water, .base = { 35, 65, 35, 65, 65, 35 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 224, .name = "Octillery", .type1 = Water, .type2 = Water, .base = { 75, 105, 75, 45, 105, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 225, .name = "Delibird", .type1 = Ice, .type2 = Flying, .base = { 45, 55, 45, 75, 65, 45 }, .growth = GROWTH_FAST },
+	{.hex = 226, .name = "Mantine", .type1 = Water, .type2 = Flying, .base = { 65, 40, 70, 70, 80, 140 }, .growth = GROWTH_SLOW },
+	{.hex = 227, .name = "Skarmory", .type1 = Steel, .type2 = Flying, .base = { 65, 80, 140, 70, 40, 70 }, .growth = GROWTH_SLOW },
+	{.hex = 228, .name = "Houndour", .type1 = Dark, .type2 = Fire, .base = { 45, 60, 30, 65, 80, 50 }, .growth = GROWTH_SLOW },
+	{.hex = 229, .name = "Houndoom", .type1 = Dark, .type2 = Fire, .base = { 75, 90, 50, 95, 110, 80 }, .growth = GROWTH_SLOW },
+	{.hex = 230, .name = "Kingdra", .type1 = Water, .type2 = Dragon, .base = { 75, 95, 95, 85, 95, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 231, .name = "Phanpy", .type1 = Ground, .type2 = Ground, .base = { 90, 60, 60, 40, 40, 40 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 232, .name = "Donphan", .type1 = Ground, .type2 = Ground, .base = { 90, 120, 120, 50, 60, 60 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 233, .name = "Porygon2", .type1 = Normal, .type2 = Normal, .base = { 85, 80, 90, 60, 105, 95 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 234, .name = "Stantler", .type1 = Normal, .type2 = Normal, .base = { 73, 95, 62, 85, 85, 65 }, .growth = GROWTH_SLOW },
+	{.hex = 235, .name = "Smeargle", .type1 = Normal, .type2 = Normal, .base = { 55, 20, 35, 75, 20, 45 }, .growth = GROWTH_FAST },
+	{.hex = 236, .name = "Tyrogue", .type1 = Fighting, .type2 = Fighting, .base = { 35, 35, 35, 35, 35, 35 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 237, .name = "Hitmontop", .type1 = Fighting, .type2 = Fighting, .base = { 50, 95, 95, 70, 35, 110 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 238, .name = "Smoochum", .type1 = Ice, .type2 = Psychic, .base = { 45, 30, 15, 65, 85, 65 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 239, .name = "Elekid", .type1 = Electric, .type2 = Electric, .base = { 45, 63, 37, 95, 65, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 240, .name = "Magby", .type1 = Fire, .type2 = Fire, .base = { 45, 75, 37, 83, 70, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 241, .name = "Miltank", .type1 = Normal, .type2 = Normal, .base = { 95, 80, 105, 100, 40, 70 }, .growth = GROWTH_SLOW },
+	{.hex = 242, .name = "Blissey", .type1 = Normal, .type2 = Normal, .base = { 255, 10, 10, 55, 75, 135 }, .growth = GROWTH_FAST },
+	{.hex = 243, .name = "Raikou", .type1 = Electric, .type2 = Electric, .base = { 90, 85, 75, 115, 115, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 244, .name = "Entei", .type1 = Fire, .type2 = Fire, .base = { 115, 115, 85, 100, 90, 75 }, .growth = GROWTH_SLOW },
+	{.hex = 245, .name = "Suicune", .type1 = Water, .type2 = Water, .base = { 100, 75, 115, 85, 90, 115 }, .growth = GROWTH_SLOW },
+	{.hex = 246, .name = "Larvitar", .type1 = Rock, .type2 = Ground, .base = { 50, 64, 50, 41, 45, 50 }, .growth = GROWTH_SLOW },
+	{.hex = 247, .name = "Pupitar", .type1 = Rock, .type2 = Ground, .base = { 70, 84, 70, 51, 65, 70 }, .growth = GROWTH_SLOW },
+	{.hex = 248, .name = "Tyranitar", .type1 = Rock, .type2 = Dark, .base = { 100, 134, 110, 61, 95, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 249, .name = "Lugia", .type1 = Psychic, .type2 = Flying, .base = { 106, 90, 130, 110, 90, 154 }, .growth = GROWTH_SLOW },
+	{.hex = 250, .name = "Ho-Oh", .type1 = Fire, .type2 = Flying, .base = { 106, 130, 90, 90, 110, 154 }, .growth = GROWTH_SLOW },
+	{.hex = 251, .name = "Celebi", .type1 = Psychic, .type2 = Grass, .base = { 100, 100, 100, 100, 100, 100 }, .growth = GROWTH_MEDIUM_SLOW },
 	{.hex = 252, .name = "?", .type1 = Normal, .type2 = Normal },
 	{.hex = 253, .name = "?", .type1 = Normal, .type2 = Normal },
 	{.hex = 254, .name = "?", .type1 = Normal, .type2 = Normal },
@@ -406,533 +442,3748 @@ const struct Pokemon pokemon_lut[] = {
 	{.hex = 274, .name = "?", .type1 = Normal, .type2 = Normal },
 	{.hex = 275, .name = "?", .type1 = Normal, .type2 = Normal },
 	{.hex = 276, .name = "?", .type1 = Normal, .type2 = Normal },
-	{.hex = 277, .name = "Treecko", .type1 = Grass, .type2 = Grass },
-	{.hex = 278, .name = "Grovyle", .type1 = Grass, .type2 = Grass },
-	{.hex = 279, .name = "Sceptile", .type1 = Grass, .type2 = Grass },
-	{.hex = 280, .name = "Torchic", .type1 = Fire, .type2 = Fire },
-	{.hex = 281, .name = "Combusken", .type1 = Fire, .type2 = Fighting },
-	{.hex = 282, .name = "Blaziken", .type1 = Fire, .type2 = Fighting },
-	{.hex = 283, .name = "Mudkip", .type1 = Water, .type2 = Water },
-	{.hex = 284, .name = "Marshtomp", .type1 = Water, .type2 = Ground },
-	{.hex = 285, .name = "Swampert", .type1 = Water, .type2 = Ground },
-	{.hex = 286, .name = "Poochyena", .type1 = Dark, .type2 = Dark },
-	{.hex = 287, .name = "Mightyena", .type1 = Dark, .type2 = Dark },
-	{.hex = 288, .name = "Zigzagoon", .type1 = Normal, .type2 = Normal },
-	{.hex = 289, .name = "Linoone", .type1 = Normal, .type2 = Normal },
-	{.hex = 290, .name = "Wurmple", .type1 = Bug, .type2 = Bug },
-	{.hex = 291, .name = "Silcoon", .type1 = Bug, .type2 = Bug },
-	{.hex = 292, .name = "Beautifly", .type1 = Bug, .type2 = Flying },
-	{.hex = 293, .name = "Cascoon", .type1 = Bug, .type2 = Bug },
-	{.hex = 294, .name = "Dustox", .type1 = Bug, .type2 = Poison },
-	{.hex = 295, .name = "Lotad", .type1 = Water, .type2 = Grass },
-	{.hex = 296, .name = "Lombre", .type1 = Water, .type2 = Grass },
-	{.hex = 297, .name = "Ludicolo", .type1 = Water, .type2 = Grass },
-	{.hex = 298, .name = "Seedot", .type1 = Grass, .type2 = Grass },
-	{.hex = 299, .name = "Nuzleaf", .type1 = Grass, .type2 = Dark },
-	{.hex = 300, .name = "Shiftry", .type1 = Grass, .type2 = Dark },
-	{.hex = 301, .name = "Nincada", .type1 = Bug, .type2 = Ground },
-	{.hex = 302, .name = "Ninjask", .type1 = Bug, .type2 = Flying },
-	{.hex = 303, .name = "Shedinja", .type1 = Bug, .type2 = Ghost },
-	{.hex = 304, .name = "Taillow", .type1 = Normal, .type2 = Flying },
-	{.hex = 305, .name = "Swellow", .type1 = Normal, .type2 = Flying },
-	{.hex = 306, .name = "Shroomish", .type1 = Grass, .type2 = Grass },
-	{.hex = 307, .name = "Breloom", .type1 = Grass, .type2 = Fighting },
-	{.hex = 308, .name = "Spinda", .type1 = Normal, .type2 = Normal },
-	{.hex = 309, .name = "Wingull", .type1 = Water, .type2 = Flying },
-	{.hex = 310, .name = "Pelipper", .type1 = Water, .type2 = Flying },
-	{.hex = 311, .name = "Surskit", .type1 = Bug, .type2 = Water },
-	{.hex = 312, .name = "Masquerain", .type1 = Bug, .type2 = Flying },
-	{.hex = 313, .name = "Wailmer", .type1 = Water, .type2 = Water },
-	{.hex = 314, .name = "Wailord", .type1 = Water, .type2 = Water },
-	{.hex = 315, .name = "Skitty", .type1 = Normal, .type2 = Normal },
-	{.hex = 316, .name = "Delcatty", .type1 = Normal, .type2 = Normal },
-	{.hex = 317, .name = "Kecleon", .type1 = Normal, .type2 = Normal },
-	{.hex = 318, .name = "Baltoy", .type1 = Ground, .type2 = Psychic },
-	{.hex = 319, .name = "Claydol", .type1 = Ground, .type2 = Psychic },
-	{.hex = 320, .name = "Nosepass", .type1 = Rock, .type2 = Rock },
-	{.hex = 321, .name = "Torkoal", .type1 = Fire, .type2 = Fire },
-	{.hex = 322, .name = "Sableye", .type1 = Dark, .type2 = Ghost },
-	{.hex = 323, .name = "Barboach", .type1 = Water, .type2 = Ground },
-	{.hex = 324, .name = "Whiscash", .type1 = Water, .type2 = Ground },
-	{.hex = 325, .name = "Luvdisc", .type1 = Water, .type2 = Water },
-	{.hex = 326, .name = "Corphish", .type1 = Water, .type2 = Water },
-	{.hex = 327, .name = "Crawdaunt", .type1 = Water, .type2 = Dark },
-	{.hex = 328, .name = "Feebas", .type1 = Water, .type2 = Water },
-	{.hex = 329, .name = "Milotic", .type1 = Water, .type2 = Water },
-	{.hex = 330, .name = "Carvanha", .type1 = Water, .type2 = Dark },
-	{.hex = 331, .name = "Sharpedo", .type1 = Water, .type2 = Dark },
-	{.hex = 332, .name = "Trapinch", .type1 = Ground, .type2 = Ground },
-	{.hex = 333, .name = "Vibrava", .type1 = Ground, .type2 = Dragon },
-	{.hex = 334, .name = "Flygon", .type1 = Ground, .type2 = Dragon },
-	{.hex = 335, .name = "Makuhita", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 336, .name = "Hariyama", .type1 = Fighting, .type2 = Fighting },
-	{.hex = 337, .name = "Electrike", .type1 = Electric, .type2 = Electric },
-	{.hex = 338, .name = "Manectric", .type1 = Electric, .type2 = Electric },
-	{.hex = 339, .name = "Numel", .type1 = Fire, .type2 = Ground },
-	{.hex = 340, .name = "Camerupt", .type1 = Fire, .type2 = Ground },
-	{.hex = 341, .name = "Spheal", .type1 = Ice, .type2 = Water },
-	{.hex = 342, .name = "Sealeo", .type1 = Ice, .type2 = Water },
-	{.hex = 343, .name = "Walrein", .type1 = Ice, .type2 = Water },
-	{.hex = 344, .name = "Cacnea", .type1 = Grass, .type2 = Grass },
-	{.hex = 345, .name = "Cacturne", .type1 = Grass, .type2 = Dark },
-	{.hex = 346, .name = "Snorunt", .type1 = Ice, .type2 = Ice },
-	{.hex = 347, .name = "Glalie", .type1 = Ice, .type2 = Ice },
-	{.hex = 348, .name = "Lunatone", .type1 = Rock, .type2 = Psychic },
-	{.hex = 349, .name = "Solrock", .type1 = Rock, .type2 = Psychic },
-	{.hex = 350, .name = "Azurill", .type1 = Normal, .type2 = Normal },
-	{.hex = 351, .name = "Spoink", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 352, .name = "Grumpig", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 353, .name = "Plusle", .type1 = Electric, .type2 = Electric },
-	{.hex = 354, .name = "Minun", .type1 = Electric, .type2 = Electric },
-	{.hex = 355, .name = "Mawile", .type1 = Steel, .type2 = Steel },
-	{.hex = 356, .name = "Meditite", .type1 = Fighting, .type2 = Psychic },
-	{.hex = 357, .name = "Medicham", .type1 = Fighting, .type2 = Psychic },
-	{.hex = 358, .name = "Swablu", .type1 = Normal, .type2 = Flying },
-	{.hex = 359, .name = "Altaria", .type1 = Dragon, .type2 = Flying },
-	{.hex = 360, .name = "Wynaut", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 361, .name = "Duskull", .type1 = Ghost, .type2 = Ghost },
-	{.hex = 362, .name = "Dusclops", .type1 = Ghost, .type2 = Ghost },
-	{.hex = 363, .name = "Roselia", .type1 = Grass, .type2 = Poison },
-	{.hex = 364, .name = "Slakoth", .type1 = Normal, .type2 = Normal },
-	{.hex = 365, .name = "Vigoroth", .type1 = Normal, .type2 = Normal },
-	{.hex = 366, .name = "Slaking", .type1 = Normal, .type2 = Normal },
-	{.hex = 367, .name = "Gulpin", .type1 = Poison, .type2 = Poison },
-	{.hex = 368, .name = "Swalot", .type1 = Poison, .type2 = Poison },
-	{.hex = 369, .name = "Tropius", .type1 = Grass, .type2 = Flying },
-	{.hex = 370, .name = "Whismur", .type1 = Normal, .type2 = Normal },
-	{.hex = 371, .name = "Loudred", .type1 = Normal, .type2 = Normal },
-	{.hex = 372, .name = "Exploud", .type1 = Normal, .type2 = Normal },
-	{.hex = 373, .name = "Clamperl", .type1 = Water, .type2 = Water },
-	{.hex = 374, .name = "Huntail", .type1 = Water, .type2 = Water },
-	{.hex = 375, .name = "Gorebyss", .type1 = Water, .type2 = Water },
-	{.hex = 376, .name = "Absol", .type1 = Dark, .type2 = Dark },
-	{.hex = 377, .name = "Shuppet", .type1 = Ghost, .type2 = Ghost },
-	{.hex = 378, .name = "Banette", .type1 = Ghost, .type2 = Ghost },
-	{.hex = 379, .name = "Seviper", .type1 = Poison, .type2 = Poison },
-	{.hex = 380, .name = "Zangoose", .type1 = Normal, .type2 = Normal },
-	{.hex = 381, .name = "Relicanth", .type1 = Rock, .type2 = Water },
-	{.hex = 382, .name = "Aron", .type1 = Steel, .type2 = Rock },
-	{.hex = 383, .name = "Lairon", .type1 = Steel, .type2 = Rock },
-	{.hex = 384, .name = "Aggron", .type1 = Steel, .type2 = Rock },
-	{.hex = 385, .name = "Castform", .type1 = Normal, .type2 = Normal },
-	{.hex = 386, .name = "Volbeat", .type1 = Bug, .type2 = Bug },
-	{.hex = 387, .name = "Illumise", .type1 = Bug, .type2 = Bug },
-	{.hex = 388, .name = "Lileep", .type1 = Rock, .type2 = Grass },
-	{.hex = 389, .name = "Cradily", .type1 = Rock, .type2 = Grass },
-	{.hex = 390, .name = "Anorith", .type1 = Rock, .type2 = Bug },
-	{.hex = 391, .name = "Armaldo", .type1 = Rock, .type2 = Bug },
-	{.hex = 392, .name = "Ralts", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 393, .name = "Kirlia", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 394, .name = "Gardevoir", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 395, .name = "Bagon", .type1 = Dragon, .type2 = Dragon },
-	{.hex = 396, .name = "Shelgon", .type1 = Dragon, .type2 = Dragon },
-	{.hex = 397, .name = "Salamence", .type1 = Dragon, .type2 = Flying },
-	{.hex = 398, .name = "Beldum", .type1 = Steel, .type2 = Psychic },
-	{.hex = 399, .name = "Metang", .type1 = Steel, .type2 = Psychic },
-	{.hex = 400, .name = "Metagross", .type1 = Steel, .type2 = Psychic },
-	{.hex = 401, .name = "Regirock", .type1 = Rock, .type2 = Rock },
-	{.hex = 402, .name = "Regice", .type1 = Ice, .type2 = Ice },
-	{.hex = 403, .name = "Registeel", .type1 = Steel, .type2 = Steel },
-	{.hex = 404, .name = "Kyogre", .type1 = Water, .type2 = Water },
-	{.hex = 405, .name = "Groudon", .type1 = Ground, .type2 = Ground },
-	{.hex = 406, .name = "Rayquaza", .type1 = Dragon, .type2 = Flying },
-	{.hex = 407, .name = "Latias", .type1 = Dragon, .type2 = Psychic },
-	{.hex = 408, .name = "Latios", .type1 = Dragon, .type2 = Psychic },
-	{.hex = 409, .name = "Jirachi", .type1 = Steel, .type2 = Psychic },
-	{.hex = 410, .name = "Deoxys", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 411, .name = "Chimecho", .type1 = Psychic, .type2 = Psychic },
+	{.hex = 277, .name = "Treecko", .type1 = Grass, .type2 = Grass, .base = { 40, 45, 35, 70, 65, 55 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 278, .name = "Grovyle", .type1 = Grass, .type2 = Grass, .base = { 50, 65, 45, 95, 85, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 279, .name = "Sceptile", .type1 = Grass, .type2 = Grass, .base = { 70, 85, 65, 120, 105, 85 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 280, .name = "Torchic", .type1 = Fire, .type2 = Fire, .base = { 45, 60, 40, 45, 70, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 281, .name = "Combusken", .type1 = Fire, .type2 = Fighting, .base = { 60, 85, 60, 55, 85, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 282, .name = "Blaziken", .type1 = Fire, .type2 = Fighting, .base = { 80, 120, 70, 80, 110, 70 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 283, .name = "Mudkip", .type1 = Water, .type2 = Water, .base = { 50, 70, 50, 40, 50, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 284, .name = "Marshtomp", .type1 = Water, .type2 = Ground, .base = { 70, 85, 70, 50, 60, 70 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 285, .name = "Swampert", .type1 = Water, .type2 = Ground, .base = { 100, 110, 90, 60, 85, 90 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 286, .name = "Poochyena", .type1 = Dark, .type2 = Dark, .base = { 35, 55, 35, 35, 30, 30 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 287, .name = "Mightyena", .type1 = Dark, .type2 = Dark, .base = { 70, 90, 70, 70, 60, 60 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 288, .name = "Zigzagoon", .type1 = Normal, .type2 = Normal, .base = { 38, 30, 41, 60, 30, 41 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 289, .name = "Linoone", .type1 = Normal, .type2 = Normal, .base = { 78, 70, 61, 100, 50, 61 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 290, .name = "Wurmple", .type1 = Bug, .type2 = Bug, .base = { 45, 45, 35, 20, 20, 30 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 291, .name = "Silcoon", .type1 = Bug, .type2 = Bug, .base = { 50, 35, 55, 15, 25, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 292, .name = "Beautifly", .type1 = Bug, .type2 = Flying, .base = { 60, 70, 50, 65, 90, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 293, .name = "Cascoon", .type1 = Bug, .type2 = Bug, .base = { 50, 35, 55, 15, 25, 25 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 294, .name = "Dustox", .type1 = Bug, .type2 = Poison, .base = { 60, 50, 70, 65, 50, 90 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 295, .name = "Lotad", .type1 = Water, .type2 = Grass, .base = { 40, 30, 30, 30, 40, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 296, .name = "Lombre", .type1 = Water, .type2 = Grass, .base = { 60, 50, 50, 50, 60, 70 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 297, .name = "Ludicolo", .type1 = Water, .type2 = Grass, .base = { 80, 70, 70, 70, 90, 100 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 298, .name = "Seedot", .type1 = Grass, .type2 = Grass, .base = { 40, 40, 50, 30, 30, 30 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 299, .name = "Nuzleaf", .type1 = Grass, .type2 = Dark, .base = { 70, 70, 40, 60, 60, 40 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 300, .name = "Shiftry", .type1 = Grass, .type2 = Dark, .base = { 90, 100, 60, 80, 90, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 301, .name = "Nincada", .type1 = Bug, .type2 = Ground, .base = { 31, 45, 90, 40, 30, 30 }, .growth = GROWTH_ERRATIC },
+	{.hex = 302, .name = "Ninjask", .type1 = Bug, .type2 = Flying, .base = { 61, 90, 45, 160, 50, 50 }, .growth = GROWTH_ERRATIC },
+	{.hex = 303, .name = "Shedinja", .type1 = Bug, .type2 = Ghost, .base = { 1, 90, 45, 40, 30, 30 }, .growth = GROWTH_ERRATIC },
+	{.hex = 304, .name = "Taillow", .type1 = Normal, .type2 = Flying, .base = { 40, 55, 30, 85, 30, 30 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 305, .name = "Swellow", .type1 = Normal, .type2 = Flying, .base = { 60, 85, 60, 125, 50, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 306, .name = "Shroomish", .type1 = Grass, .type2 = Grass, .base = { 60, 40, 60, 35, 40, 60 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 307, .name = "Breloom", .type1 = Grass, .type2 = Fighting, .base = { 60, 130, 80, 70, 60, 60 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 308, .name = "Spinda", .type1 = Normal, .type2 = Normal, .base = { 60, 60, 60, 60, 60, 60 }, .growth = GROWTH_FAST },
+	{.hex = 309, .name = "Wingull", .type1 = Water, .type2 = Flying, .base = { 40, 30, 30, 85, 55, 30 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 310, .name = "Pelipper", .type1 = Water, .type2 = Flying, .base = { 60, 50, 100, 65, 85, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 311, .name = "Surskit", .type1 = Bug, .type2 = Water, .base = { 40, 30, 32, 65, 50, 52 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 312, .name = "Masquerain", .type1 = Bug, .type2 = Flying, .base = { 70, 60, 62, 60, 80, 82 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 313, .name = "Wailmer", .type1 = Water, .type2 = Water, .base = { 130, 70, 35, 60, 70, 35 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 314, .name = "Wailord", .type1 = Water, .type2 = Water, .base = { 170, 90, 45, 60, 90, 45 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 315, .name = "Skitty", .type1 = Normal, .type2 = Normal, .base = { 50, 45, 45, 50, 35, 35 }, .growth = GROWTH_FAST },
+	{.hex = 316, .name = "Delcatty", .type1 = Normal, .type2 = Normal, .base = { 70, 65, 65, 70, 55, 55 }, .growth = GROWTH_FAST },
+	{.hex = 317, .name = "Kecleon", .type1 = Normal, .type2 = Normal, .base = { 60, 90, 70, 40, 60, 120 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 318, .name = "Baltoy", .type1 = Ground, .type2 = Psychic, .base = { 40, 40, 55, 55, 40, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 319, .name = "Claydol", .type1 = Ground, .type2 = Psychic, .base = { 60, 70, 105, 75, 70, 120 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 320, .name = "Nosepass", .type1 = Rock, .type2 = Rock, .base = { 30, 45, 135, 30, 45, 90 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 321, .name = "Torkoal", .type1 = Fire, .type2 = Fire, .base = { 70, 85, 140, 20, 85, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 322, .name = "Sableye", .type1 = Dark, .type2 = Ghost, .base = { 50, 75, 75, 50, 65, 65 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 323, .name = "Barboach", .type1 = Water, .type2 = Ground, .base = { 50, 48, 43, 60, 46, 41 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 324, .name = "Whiscash", .type1 = Water, .type2 = Ground, .base = { 110, 78, 73, 60, 76, 71 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 325, .name = "Luvdisc", .type1 = Water, .type2 = Water, .base = { 43, 30, 55, 97, 40, 65 }, .growth = GROWTH_FAST },
+	{.hex = 326, .name = "Corphish", .type1 = Water, .type2 = Water, .base = { 43, 80, 65, 35, 50, 35 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 327, .name = "Crawdaunt", .type1 = Water, .type2 = Dark, .base = { 63, 120, 85, 55, 90, 55 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 328, .name = "Feebas", .type1 = Water, .type2 = Water, .base = { 20, 15, 20, 80, 10, 55 }, .growth = GROWTH_ERRATIC },
+	{.hex = 329, .name = "Milotic", .type1 = Water, .type2 = Water, .base = { 95, 60, 79, 81, 100, 125 }, .growth = GROWTH_ERRATIC },
+	{.hex = 330, .name = "Carvanha", .type1 = Water, .type2 = Dark, .base = { 45, 90, 20, 65, 65, 20 }, .growth = GROWTH_SLOW },
+	{.hex = 331, .name = "Sharpedo", .type1 = Water, .type2 = Dark, .base = { 70, 120, 40, 95, 95, 40 }, .growth = GROWTH_SLOW },
+	{.hex = 332, .name = "Trapinch", .type1 = Ground, .type2 = Ground, .base = { 45, 100, 45, 10, 45, 45 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 333, .name = "Vibrava", .type1 = Ground, .type2 = Dragon, .base = { 50, 70, 50, 70, 50, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 334, .name = "Flygon", .type1 = Ground, .type2 = Dragon, .base = { 80, 100, 80, 100, 80, 80 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 335, .name = "Makuhita", .type1 = Fighting, .type2 = Fighting, .base = { 72, 60, 30, 25, 20, 30 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 336, .name = "Hariyama", .type1 = Fighting, .type2 = Fighting, .base = { 144, 120, 60, 50, 40, 60 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 337, .name = "Electrike", .type1 = Electric, .type2 = Electric, .base = { 40, 45, 40, 65, 65, 40 }, .growth = GROWTH_SLOW },
+	{.hex = 338, .name = "Manectric", .type1 = Electric, .type2 = Electric, .base = { 70, 75, 60, 105, 105, 60 }, .growth = GROWTH_SLOW },
+	{.hex = 339, .name = "Numel", .type1 = Fire, .type2 = Ground, .base = { 60, 60, 40, 35, 65, 45 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 340, .name = "Camerupt", .type1 = Fire, .type2 = Ground, .base = { 70, 100, 70, 40, 105, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 341, .name = "Spheal", .type1 = Ice, .type2 = Water, .base = { 70, 40, 50, 25, 55, 50 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 342, .name = "Sealeo", .type1 = Ice, .type2 = Water, .base = { 90, 60, 70, 45, 75, 70 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 343, .name = "Walrein", .type1 = Ice, .type2 = Water, .base = { 110, 80, 90, 65, 95, 90 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 344, .name = "Cacnea", .type1 = Grass, .type2 = Grass, .base = { 50, 85, 40, 35, 85, 40 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 345, .name = "Cacturne", .type1 = Grass, .type2 = Dark, .base = { 70, 115, 60, 55, 115, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 346, .name = "Snorunt", .type1 = Ice, .type2 = Ice, .base = { 50, 50, 50, 50, 50, 50 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 347, .name = "Glalie", .type1 = Ice, .type2 = Ice, .base = { 80, 80, 80, 80, 80, 80 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 348, .name = "Lunatone", .type1 = Rock, .type2 = Psychic, .base = { 70, 55, 65, 70, 95, 85 }, .growth = GROWTH_FAST },
+	{.hex = 349, .name = "Solrock", .type1 = Rock, .type2 = Psychic, .base = { 70, 95, 85, 70, 55, 65 }, .growth = GROWTH_FAST },
+	{.hex = 350, .name = "Azurill", .type1 = Normal, .type2 = Normal, .base = { 50, 20, 40, 20, 20, 40 }, .growth = GROWTH_FAST },
+	{.hex = 351, .name = "Spoink", .type1 = Psychic, .type2 = Psychic, .base = { 60, 25, 35, 60, 70, 80 }, .growth = GROWTH_FAST },
+	{.hex = 352, .name = "Grumpig", .type1 = Psychic, .type2 = Psychic, .base = { 80, 45, 65, 80, 90, 110 }, .growth = GROWTH_FAST },
+	{.hex = 353, .name = "Plusle", .type1 = Electric, .type2 = Electric, .base = { 60, 50, 40, 95, 85, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 354, .name = "Minun", .type1 = Electric, .type2 = Electric, .base = { 60, 40, 50, 95, 75, 85 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 355, .name = "Mawile", .type1 = Steel, .type2 = Steel, .base = { 50, 85, 85, 50, 55, 55 }, .growth = GROWTH_FAST },
+	{.hex = 356, .name = "Meditite", .type1 = Fighting, .type2 = Psychic, .base = { 30, 40, 55, 60, 40, 55 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 357, .name = "Medicham", .type1 = Fighting, .type2 = Psychic, .base = { 60, 60, 75, 80, 60, 75 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 358, .name = "Swablu", .type1 = Normal, .type2 = Flying, .base = { 45, 40, 60, 50, 40, 75 }, .growth = GROWTH_ERRATIC },
+	{.hex = 359, .name = "Altaria", .type1 = Dragon, .type2 = Flying, .base = { 75, 70, 90, 80, 70, 105 }, .growth = GROWTH_ERRATIC },
+	{.hex = 360, .name = "Wynaut", .type1 = Psychic, .type2 = Psychic, .base = { 95, 23, 48, 23, 23, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 361, .name = "Duskull", .type1 = Ghost, .type2 = Ghost, .base = { 20, 40, 90, 25, 30, 90 }, .growth = GROWTH_FAST },
+	{.hex = 362, .name = "Dusclops", .type1 = Ghost, .type2 = Ghost, .base = { 40, 70, 130, 25, 60, 130 }, .growth = GROWTH_FAST },
+	{.hex = 363, .name = "Roselia", .type1 = Grass, .type2 = Poison, .base = { 50, 60, 45, 65, 100, 80 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 364, .name = "Slakoth", .type1 = Normal, .type2 = Normal, .base = { 60, 60, 60, 30, 35, 35 }, .growth = GROWTH_SLOW },
+	{.hex = 365, .name = "Vigoroth", .type1 = Normal, .type2 = Normal, .base = { 80, 80, 80, 90, 55, 55 }, .growth = GROWTH_SLOW },
+	{.hex = 366, .name = "Slaking", .type1 = Normal, .type2 = Normal, .base = { 150, 160, 100, 100, 95, 65 }, .growth = GROWTH_SLOW },
+	{.hex = 367, .name = "Gulpin", .type1 = Poison, .type2 = Poison, .base = { 70, 43, 53, 40, 43, 53 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 368, .name = "Swalot", .type1 = Poison, .type2 = Poison, .base = { 100, 73, 83, 55, 73, 83 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 369, .name = "Tropius", .type1 = Grass, .type2 = Flying, .base = { 99, 68, 83, 51, 72, 87 }, .growth = GROWTH_SLOW },
+	{.hex = 370, .name = "Whismur", .type1 = Normal, .type2 = Normal, .base = { 64, 51, 23, 28, 51, 23 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 371, .name = "Loudred", .type1 = Normal, .type2 = Normal, .base = { 84, 71, 43, 48, 71, 43 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 372, .name = "Exploud", .type1 = Normal, .type2 = Normal, .base = { 104, 91, 63, 68, 91, 63 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 373, .name = "Clamperl", .type1 = Water, .type2 = Water, .base = { 35, 64, 85, 32, 74, 55 }, .growth = GROWTH_ERRATIC },
+	{.hex = 374, .name = "Huntail", .type1 = Water, .type2 = Water, .base = { 55, 104, 105, 52, 94, 75 }, .growth = GROWTH_ERRATIC },
+	{.hex = 375, .name = "Gorebyss", .type1 = Water, .type2 = Water, .base = { 55, 84, 105, 52, 114, 75 }, .growth = GROWTH_ERRATIC },
+	{.hex = 376, .name = "Absol", .type1 = Dark, .type2 = Dark, .base = { 65, 130, 60, 75, 75, 60 }, .growth = GROWTH_MEDIUM_SLOW },
+	{.hex = 377, .name = "Shuppet", .type1 = Ghost, .type2 = Ghost, .base = { 44, 75, 35, 45, 63, 33 }, .growth = GROWTH_FAST },
+	{.hex = 378, .name = "Banette", .type1 = Ghost, .type2 = Ghost, .base = { 64, 115, 65, 65, 83, 63 }, .growth = GROWTH_FAST },
+	{.hex = 379, .name = "Seviper", .type1 = Poison, .type2 = Poison, .base = { 73, 100, 60, 65, 100, 60 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 380, .name = "Zangoose", .type1 = Normal, .type2 = Normal, .base = { 73, 115, 60, 90, 60, 60 }, .growth = GROWTH_ERRATIC },
+	{.hex = 381, .name = "Relicanth", .type1 = Rock, .type2 = Water, .base = { 100, 90, 130, 55, 45, 65 }, .growth = GROWTH_SLOW },
+	{.hex = 382, .name = "Aron", .type1 = Steel, .type2 = Rock, .base = { 50, 70, 100, 30, 40, 40 }, .growth = GROWTH_SLOW },
+	{.hex = 383, .name = "Lairon", .type1 = Steel, .type2 = Rock, .base = { 60, 90, 140, 40, 50, 50 }, .growth = GROWTH_SLOW },
+	{.hex = 384, .name = "Aggron", .type1 = Steel, .type2 = Rock, .base = { 70, 110, 180, 50, 60, 60 }, .growth = GROWTH_SLOW },
+	{.hex = 385, .name = "Castform", .type1 = Normal, .type2 = Normal, .base = { 70, 70, 70, 70, 70, 70 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 386, .name = "Volbeat", .type1 = Bug, .type2 = Bug, .base = { 65, 73, 55, 85, 47, 75 }, .growth = GROWTH_ERRATIC },
+	{.hex = 387, .name = "Illumise", .type1 = Bug, .type2 = Bug, .base = { 65, 47, 55, 85, 73, 75 }, .growth = GROWTH_FLUCTUATING },
+	{.hex = 388, .name = "Lileep", .type1 = Rock, .type2 = Grass, .base = { 66, 41, 77, 23, 61, 87 }, .growth = GROWTH_ERRATIC },
+	{.hex = 389, .name = "Cradily", .type1 = Rock, .type2 = Grass, .base = { 86, 81, 97, 43, 81, 107 }, .growth = GROWTH_ERRATIC },
+	{.hex = 390, .name = "Anorith", .type1 = Rock, .type2 = Bug, .base = { 45, 95, 50, 75, 40, 50 }, .growth = GROWTH_ERRATIC },
+	{.hex = 391, .name = "Armaldo", .type1 = Rock, .type2 = Bug, .base = { 75, 125, 100, 45, 70, 80 }, .growth = GROWTH_ERRATIC },
+	{.hex = 392, .name = "Ralts", .type1 = Psychic, .type2 = Psychic, .base = { 28, 25, 25, 40, 45, 35 }, .growth = GROWTH_SLOW },
+	{.hex = 393, .name = "Kirlia", .type1 = Psychic, .type2 = Psychic, .base = { 38, 35, 35, 50, 65, 55 }, .growth = GROWTH_SLOW },
+	{.hex = 394, .name = "Gardevoir", .type1 = Psychic, .type2 = Psychic, .base = { 68, 65, 65, 80, 125, 115 }, .growth = GROWTH_SLOW },
+	{.hex = 395, .name = "Bagon", .type1 = Dragon, .type2 = Dragon, .base = { 45, 75, 60, 50, 40, 30 }, .growth = GROWTH_SLOW },
+	{.hex = 396, .name = "Shelgon", .type1 = Dragon, .type2 = Dragon, .base = { 65, 95, 100, 50, 60, 50 }, .growth = GROWTH_SLOW },
+	{.hex = 397, .name = "Salamence", .type1 = Dragon, .type2 = Flying, .base = { 95, 135, 80, 100, 110, 80 }, .growth = GROWTH_SLOW },
+	{.hex = 398, .name = "Beldum", .type1 = Steel, .type2 = Psychic, .base = { 40, 55, 80, 30, 35, 60 }, .growth = GROWTH_SLOW },
+	{.hex = 399, .name = "Metang", .type1 = Steel, .type2 = Psychic, .base = { 60, 75, 100, 50, 55, 80 }, .growth = GROWTH_SLOW },
+	{.hex = 400, .name = "Metagross", .type1 = Steel, .type2 = Psychic, .base = { 80, 135, 130, 70, 95, 90 }, .growth = GROWTH_SLOW },
+	{.hex = 401, .name = "Regirock", .type1 = Rock, .type2 = Rock, .base = { 80, 100, 200, 50, 50, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 402, .name = "Regice", .type1 = Ice, .type2 = Ice, .base = { 80, 50, 100, 50, 100, 200 }, .growth = GROWTH_SLOW },
+	{.hex = 403, .name = "Registeel", .type1 = Steel, .type2 = Steel, .base = { 80, 75, 150, 50, 75, 150 }, .growth = GROWTH_SLOW },
+	{.hex = 404, .name = "Kyogre", .type1 = Water, .type2 = Water, .base = { 100, 100, 90, 90, 150, 140 }, .growth = GROWTH_SLOW },
+	{.hex = 405, .name = "Groudon", .type1 = Ground, .type2 = Ground, .base = { 100, 150, 140, 90, 100, 90 }, .growth = GROWTH_SLOW },
+	{.hex = 406, .name = "Rayquaza", .type1 = Dragon, .type2 = Flying, .base = { 105, 150, 90, 95, 150, 90 }, .growth = GROWTH_SLOW },
+	{.hex = 407, .name = "Latias", .type1 = Dragon, .type2 = Psychic, .base = { 80, 80, 90, 110, 110, 130 }, .growth = GROWTH_SLOW },
+	{.hex = 408, .name = "Latios", .type1 = Dragon, .type2 = Psychic, .base = { 80, 90, 80, 110, 130, 110 }, .growth = GROWTH_SLOW },
+	{.hex = 409, .name = "Jirachi", .type1 = Steel, .type2 = Psychic, .base = { 100, 100, 100, 100, 100, 100 }, .growth = GROWTH_SLOW },
+	{.hex = 410, .name = "Deoxys", .type1 = Psychic, .type2 = Psychic, .base = { 50, 95, 90, 180, 95, 90 }, .growth = GROWTH_SLOW },
+	{.hex = 411, .name = "Chimecho", .type1 = Psychic, .type2 = Psychic, .base = { 65, 50, 70, 65, 95, 80 }, .growth = GROWTH_FAST },
 	{.hex = 412, .name = "Pokémon", .type1 = Egg, .type2 = Egg },
-	{.hex = 413, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 414, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 415, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 416, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 417, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 418, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 419, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 420, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 421, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 422, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 423, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 424, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 425, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 426, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 427, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 428, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 429, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 430, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 431, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 432, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 433, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 434, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 435, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 436, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 437, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 438, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
-	{.hex = 439, .name = "Unown", .type1 = Psychic, .type2 = Psychic },
+	{.hex = 413, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 414, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 415, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 416, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 417, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 418, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 419, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 420, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 421, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 422, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 423, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 424, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 425, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 426, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 427, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 428, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 429, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 430, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 431, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 432, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 433, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 434, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 435, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 436, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 437, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 438, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
+	{.hex = 439, .name = "Unown", .type1 = Psychic, .type2 = Psychic, .base = { 48, 72, 48, 48, 72, 48 }, .growth = GROWTH_MEDIUM_FAST },
 	{.hex = 440, .name = "????????", .type1 = Normal, .type2 = Normal },
 };
 
-void dump_team_info(const uint8_t *base, const uint32_t sec_key) {
+// national dex #252 onwards, gen 3 stores hoenn species in a different order internally
+const uint16_t hoenn_species[] = {
+	277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288,
+	289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+	304, 305, 309, 310, 392, 393, 394, 311, 312, 306, 307, 364,
+	365, 366, 301, 302, 303, 370, 371, 372, 335, 336, 350, 320,
+	315, 316, 322, 355, 382, 383, 384, 356, 357, 337, 338, 353,
+	354, 386, 387, 363, 367, 368, 330, 331, 313, 314, 339, 340,
+	321, 351, 352, 308, 332, 333, 334, 344, 345, 358, 359, 380,
+	379, 348, 349, 323, 324, 326, 327, 318, 319, 388, 389, 390,
+	391, 328, 329, 385, 317, 377, 378, 361, 362, 369, 411, 376,
+	360, 346, 347, 341, 342, 343, 373, 374, 375, 381, 325, 395,
+	396, 397, 398, 399, 400, 401, 402, 403, 407, 408, 404, 405,
+	406, 409, 410,
+};
+
+uint16_t national_to_species(const uint16_t dex) {
+	if (dex <= 251)
+		return dex;
+	if (dex <= DEX_COUNT)
+		return hoenn_species[dex - 252];
+	return 0;
+}
+
+union PokemonData {
+	uint32_t data[12];
+	struct {
+		uint8_t data_g[12];
+		uint8_t data_a[12];
+		uint8_t data_e[12];
+		uint8_t data_m[12];
+	};
+};
+
+// decrypts the 48 bytes of substructures and puts them back in GAEM order.
+// the layout is shared by party (100 byte) and boxed (80 byte) pokemon.
+void unshuffle_pokemon(union PokemonData *raw_data, const uint8_t *pokemon) {
 	enum {
-		TEAM_SIZE = 0x234,     // 4
-		TEAM_POKEMON = 0x238,  // 600
-		MONEY = 0x490,         // 4
-		COINS = 0x494,         // 2
-		PC_ITEMS = 0x498,      // 200
-		BAG_ITEMS = 0x560,     // 80
-		KEY_ITEMS = 0x5D8,     // 80
-		BALL_ITEMS = 0x650,    // 64
-		TM_ITEMS = 0x690,      // 256
-		BERRY_ITEMS = 0x790    // 184
+		PERSONALITY = 0, // 4
+		OT_ID = 4,   // 4
+		TRICKY_DATA = 32,
 	};
 
-	struct TeamInfo {
-		uint32_t team_size;
-		struct {
-			uint32_t personality;
-			uint32_t ot_id;
-			uint8_t nickname[11]; // +1 for terminator
-			uint16_t lang;
-			uint8_t ot_name[8];
-			uint8_t markings;
+	uint32_t personality, ot_id;
+	memcpy(&personality, pokemon + PERSONALITY, 4);
+	memcpy(&ot_id, pokemon + OT_ID, 4);
+
+	uint8_t order = personality % 24;
+	switch (order) {
+		case  0: // GAEM
+		case  1: // GAME
+		case  2: // GEAM
+		case  3: // GEMA
+		case  4: // GMAE
+		case  5: // GMEA
+			memcpy(raw_data->data_g, pokemon + TRICKY_DATA, 12);
+			break;
+		case  6: // AGEM
+		case  7: // AGME
+		case  8: // AEGM
+		case  9: // AEMG
+		case 10: // AMGE
+		case 11: // AMEG
+			memcpy(raw_data->data_a, pokemon + TRICKY_DATA, 12);
+			break;
+		case 12: // EGAM
+		case 13: // EGMA
+		case 14: // EAGM
+		case 15: // EAMG
+		case 16: // EMGA
+		case 17: // EMAG
+			memcpy(raw_data->data_e, pokemon + TRICKY_DATA, 12);
+			break;
+		case 18: // MGAE
+		case 19: // MGEA
+		case 20: // MAGE
+		case 21: // MAEG
+		case 22: // MEGA
+		case 23: // MEAG
+			memcpy(raw_data->data_m, pokemon + TRICKY_DATA, 12);
+			break;
+		default: break;
+	}
+
+	switch (order) {
+		case  6: // AGEM
+		case  7: // AGME
+		case 12: // EGAM
+		case 13: // EGMA
+		case 18: // MGAE
+		case 19: // MGEA
+			memcpy(raw_data->data_g, pokemon + TRICKY_DATA + 12, 12);
+			break;
+		case  0: // GAEM
+		case  1: // GAME
+		case 14: // EAGM
+		case 15: // EAMG
+		case 21: // MAEG
+		case 20: // MAGE
+			memcpy(raw_data->data_a, pokemon + TRICKY_DATA + 12, 12);
+			break;
+		case  2: // GEAM
+		case  3: // GEMA
+		case  8: // AEGM
+		case  9: // AEMG
+		case 22: // MEGA
+		case 23: // MEAG
+			memcpy(raw_data->data_e, pokemon + TRICKY_DATA + 12, 12);
+			break;
+		case  4: // GMAE
+		case  5: // GMEA
+		case 10: // AMGE
+		case 11: // AMEG
+		case 16: // EMGA
+		case 17: // EMAG
+			memcpy(raw_data->data_m, pokemon + TRICKY_DATA + 12, 12);
+			break;
+		default: break;
+	}
+
+	switch (order) {
+		case 14: // EAGM
+		case 20: // MAGE
+		case  8: // AEGM
+		case 22: // MEGA
+		case 10: // AMGE
+		case 16: // EMGA
+			memcpy(raw_data->data_g, pokemon + TRICKY_DATA + 24, 12);
+			break;
+		case 12: // EGAM
+		case 18: // MGAE
+		case  2: // GEAM
+		case  4: // GMAE
+		case 23: // MEAG
+		case 17: // EMAG
+			memcpy(raw_data->data_a, pokemon + TRICKY_DATA + 24, 12);
+			break;
+		case  6: // AGEM
+		case 19: // MGEA
+		case  0: // GAEM
+		case 21: // MAEG
+		case  5: // GMEA
+		case 11: // AMEG
+			memcpy(raw_data->data_e, pokemon + TRICKY_DATA + 24, 12);
+			break;
+		case  7: // AGME
+		case 13: // EGMA
+		case  1: // GAME
+		case 15: // EAMG
+		case  3: // GEMA
+		case  9: // AEMG
+			memcpy(raw_data->data_m, pokemon + TRICKY_DATA + 24, 12);
+			break;
+		default: break;
+	}
+
+	switch (order) {
+		case  9: // AEMG
+		case 11: // AMEG
+		case 15: // EAMG
+		case 21: // MAEG
+		case 17: // EMAG
+		case 23: // MEAG
+			memcpy(raw_data->data_g, pokemon + TRICKY_DATA + 36, 12);
+			break;
+		case  3: // GEMA
+		case  5: // GMEA
+		case 13: // EGMA
+		case 16: // EMGA
+		case 19: // MGEA
+		case 22: // MEGA
+			memcpy(raw_data->data_a, pokemon + TRICKY_DATA + 36, 12);
+			break;
+		case  1: // GAME
+		case  4: // GMAE
+		case  7: // AGME
+		case 10: // AMGE
+		case 18: // MGAE
+		case 20: // MAGE
+			memcpy(raw_data->data_e, pokemon + TRICKY_DATA + 36, 12);
+			break;
+		case  0: // GAEM
+		case  2: // GEAM
+		case  6: // AGEM
+		case  8: // AEGM
+		case 12: // EGAM
+		case 14: // EAGM
+			memcpy(raw_data->data_m, pokemon + TRICKY_DATA + 36, 12);
+			break;
+		default: break;
+	}
+
+	uint32_t key = ot_id ^ personality;
+	for (int i = 0; i < 12; i++) {
+		raw_data->data[i] ^= key;
+	}
+}
+
+enum {
+	BOX_POKEMON_SIZE = 80,
+	PARTY_POKEMON_SIZE = 100,
+	POKEMON_CHECKSUM = 28,
+	PARTY_LEVEL = 84,
+	PARTY_STATS = 88 // 12, total hp onwards in stat order
+};
+
+// no lookups past the end of the table for corrupt or hacked species
+const struct Pokemon *species_info(const uint16_t species) {
+	if (species >= sizeof(pokemon_lut) / sizeof(pokemon_lut[0]))
+		return NULL;
+	return &pokemon_lut[species];
+}
+
+// the checksum is the sum of the 24 decrypted halfwords. addition doesn't care
+// about substructure order so there's no need to unshuffle first.
+uint16_t pokemon_checksum(const uint8_t *pokemon) {
+	uint32_t personality, ot_id;
+	memcpy(&personality, pokemon, 4);
+	memcpy(&ot_id, pokemon + 4, 4);
+	const uint32_t key = personality ^ ot_id;
+
+	uint32_t sum = 0;
+	for (int i = 0; i < 12; i++) {
+		uint32_t word;
+		memcpy(&word, pokemon + 32 + i * 4, 4);
+		word ^= key;
+		sum += (word & 0xFFFF) + (word >> 16);
+	}
+	return sum & 0xFFFF;
+}
+
+// sets valid[i] for each record whose checksum matches, returns the number that don't
+size_t check_pokemon_scalar(bool *valid, const uint8_t *const *pokemon, const size_t count) {
+	size_t bad = 0;
+	for (size_t i = 0; i < count; i++) {
+		uint16_t stored;
+		memcpy(&stored, pokemon[i] + POKEMON_CHECKSUM, 2);
+		valid[i] = pokemon_checksum(pokemon[i]) == stored;
+		bad += !valid[i];
+	}
+	return bad;
+}
+
+size_t check_pokemon(bool *valid, const uint8_t *const *pokemon, const size_t count) {
+#ifdef __SSE2__
+	// four pokemon at a time: xor and add each one's substructures lane-wise,
+	// then reduce the four sets of partial sums together.
+	const __m128i ones = _mm_set1_epi16(1);
+	const __m128i low = _mm_set1_epi32(0xFFFF);
+	size_t bad = 0;
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i sums[4];
+		uint32_t stored[4];
+		for (int j = 0; j < 4; j++) {
+			const uint8_t *p = pokemon[i + j];
+			uint32_t personality, ot_id;
 			uint16_t checksum;
-			uint16_t unknown;
-			union {
-				//uint8_t data[48];
-				struct {
-					uint8_t data0[12];
-					uint8_t data1[12];
-					uint8_t data2[12];
-					uint8_t data3[12];
-				};
-			};
-			uint32_t status;
-			uint8_t level;
-			uint8_t pokerus;
-			uint16_t current_hp;
-			uint16_t total_hp;
-			uint16_t attack;
-			uint16_t defense;
-			uint16_t speed;
-			uint16_t sp_attack;
-			uint16_t sp_defense;
-		} pokemon[6];
-		uint32_t money;
-		uint16_t coins;
-		struct {
-			uint8_t data[200];
-		} pc_items;
-	} info;
-
-	memcpy(&info.team_size, base + TEAM_SIZE, 4);
-	memcpy(&info.pokemon, base + TEAM_POKEMON, 600);
-	memcpy(&info.money, base + MONEY, 4);
-
-	for (size_t i = 0; i < info.team_size; i++) {
-		const uint8_t *pokemon = base + TEAM_POKEMON + i * 100;
-		enum {
-			NICKNAME = 8, // 10
-			PERSONALITY = 0, // 4
-			OT_ID = 4,   // 4
-			OT_NAME = 20, // 7
-			MARKINGS = 27, // 1
-			LEVEL = 84,   // 1
-			POKERUS = 85,  // 1
-			TRICKY_DATA = 32,
-		};
+			memcpy(&personality, p, 4);
+			memcpy(&ot_id, p + 4, 4);
+			memcpy(&checksum, p + POKEMON_CHECKSUM, 2);
+			stored[j] = checksum;
 
-		memcpy(&info.pokemon[i].personality, pokemon + PERSONALITY, 4);
-		decode_text(&info.pokemon[i].nickname, pokemon + NICKNAME, 10);
-		memcpy(&info.pokemon[i].ot_id, pokemon + OT_ID, 4);
-		decode_text(info.pokemon[i].ot_name, pokemon + OT_NAME, 7);
-		//printf("%s (OT: %s)\n", info.pokemon[i].nickname, info.pokemon[i].ot_name);
-		memcpy(&info.pokemon[i].level, pokemon + LEVEL, 1);
-		//printf("lv %d\n", info.pokemon[i].level);
-		//memcpy(&info.pokemon[i].pokerus, pokemon + POKERUS, 1);
-		//printf("pokerus remaining %d\n", info.pokemon[i].pokerus);
-		union {
-			uint32_t data[12];
-			struct {
-				uint8_t data_g[12];
-				uint8_t data_a[12];
-				uint8_t data_e[12];
-				uint8_t data_m[12];
-			};
-		} raw_data;
-
-		uint8_t order = info.pokemon[i].personality % 24;
-		switch (order) {
-			case  0: // GAEM
-			case  1: // GAME
-			case  2: // GEAM
-			case  3: // GEMA
-			case  4: // GMAE
-			case  5: // GMEA
-				memcpy(raw_data.data_g, pokemon + TRICKY_DATA, 12);
-				break;
-			case  6: // AGEM
-			case  7: // AGME
-			case  8: // AEGM
-			case  9: // AEMG
-			case 10: // AMGE
-			case 11: // AMEG
-				memcpy(raw_data.data_a, pokemon + TRICKY_DATA, 12);
-				break;
-			case 12: // EGAM
-			case 13: // EGMA
-			case 14: // EAGM
-			case 15: // EAMG
-			case 16: // EMGA
-			case 17: // EMAG
-				memcpy(raw_data.data_e, pokemon + TRICKY_DATA, 12);
-				break;
-			case 18: // MGAE
-			case 19: // MGEA
-			case 20: // MAGE
-			case 21: // MAEG
-			case 22: // MEGA
-			case 23: // MEAG
-				memcpy(raw_data.data_m, pokemon + TRICKY_DATA, 12);
-				break;
-			default: break;
+			const __m128i key = _mm_set1_epi32(personality ^ ot_id);
+			__m128i a = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + 32)), key);
+			__m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + 48)), key);
+			__m128i c = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + 64)), key);
+			// 16 bit lanes wrap, which is fine since only the low 16 bits count
+			sums[j] = _mm_madd_epi16(_mm_add_epi16(_mm_add_epi16(a, b), c), ones);
 		}
 
-		switch (order) {
-			case  6: // AGEM
-			case  7: // AGME
-			case 12: // EGAM
-			case 13: // EGMA
-			case 18: // MGAE
-			case 19: // MGEA
-				memcpy(raw_data.data_g, pokemon + TRICKY_DATA + 12, 12);
-				break;
-			case  0: // GAEM
-			case  1: // GAME
-			case 14: // EAGM
-			case 15: // EAMG
-			case 21: // MAEG
-			case 20: // MAGE
-				memcpy(raw_data.data_a, pokemon + TRICKY_DATA + 12, 12);
-				break;
-			case  2: // GEAM
-			case  3: // GEMA
-			case  8: // AEGM
-			case  9: // AEMG
-			case 22: // MEGA
-			case 23: // MEAG
-				memcpy(raw_data.data_e, pokemon + TRICKY_DATA + 12, 12);
-				break;
-			case  4: // GMAE
-			case  5: // GMEA
-			case 10: // AMGE
-			case 11: // AMEG
-			case 16: // EMGA
-			case 17: // EMAG
-				memcpy(raw_data.data_m, pokemon + TRICKY_DATA + 12, 12);
-				break;
-			default: break;
-		}
+		// transpose-and-add so lane j ends up holding pokemon j's total
+		__m128i ab = _mm_add_epi32(_mm_unpacklo_epi32(sums[0], sums[1]), _mm_unpackhi_epi32(sums[0], sums[1]));
+		__m128i cd = _mm_add_epi32(_mm_unpacklo_epi32(sums[2], sums[3]), _mm_unpackhi_epi32(sums[2], sums[3]));
+		__m128i total = _mm_add_epi32(_mm_unpacklo_epi64(ab, cd), _mm_unpackhi_epi64(ab, cd));
+		total = _mm_and_si128(total, low);
 
-		switch (order) {
-			case 14: // EAGM
-			case 20: // MAGE
-			case  8: // AEGM
-			case 22: // MEGA
-			case 10: // AMGE
-			case 16: // EMGA
-				memcpy(raw_data.data_g, pokemon + TRICKY_DATA + 24, 12);
-				break;
-			case 12: // EGAM
-			case 18: // MGAE
-			case  2: // GEAM
-			case  4: // GMAE
-			case 23: // MEAG
-			case 17: // EMAG
-				memcpy(raw_data.data_a, pokemon + TRICKY_DATA + 24, 12);
-				break;
-			case  6: // AGEM
-			case 19: // MGEA
-			case  0: // GAEM
-			case 21: // MAEG
-			case  5: // GMEA
-			case 11: // AMEG
-				memcpy(raw_data.data_e, pokemon + TRICKY_DATA + 24, 12);
-				break;
-			case  7: // AGME
-			case 13: // EGMA
-			case  1: // GAME
-			case 15: // EAMG
-			case  3: // GEMA
-			case  9: // AEMG
-				memcpy(raw_data.data_m, pokemon + TRICKY_DATA + 24, 12);
-				break;
-			default: break;
+		__m128i expected = _mm_loadu_si128((const __m128i *)stored);
+		int match = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(total, expected)));
+		for (int j = 0; j < 4; j++) {
+			valid[i + j] = match >> j & 1;
 		}
+		bad += 4 - __builtin_popcount(match);
+	}
+	return bad + check_pokemon_scalar(valid + i, pokemon + i, count - i);
+#else
+	return check_pokemon_scalar(valid, pokemon, count);
+#endif
+}
 
-		switch (order) {
-			case  9: // AEMG
-			case 11: // AMEG
-			case 15: // EAMG
-			case 21: // MAEG
-			case 17: // EMAG
-			case 23: // MEAG
-				memcpy(raw_data.data_g, pokemon + TRICKY_DATA + 36, 12);
-				break;
-			case  3: // GEMA
-			case  5: // GMEA
-			case 13: // EGMA
-			case 16: // EMGA
-			case 19: // MGEA
-			case 22: // MEGA
-				memcpy(raw_data.data_a, pokemon + TRICKY_DATA + 36, 12);
-				break;
-			case  1: // GAME
-			case  4: // GMAE
-			case  7: // AGME
-			case 10: // AMGE
-			case 18: // MGAE
-			case 20: // MAGE
-				memcpy(raw_data.data_e, pokemon + TRICKY_DATA + 36, 12);
-				break;
-			case  0: // GAEM
-			case  2: // GEAM
-			case  6: // AGEM
-			case  8: // AEGM
-			case 12: // EGAM
-			case 14: // EAGM
-				memcpy(raw_data.data_m, pokemon + TRICKY_DATA + 36, 12);
-				break;
-			default: break;
+// nature is personality % 25. it raises the stat at 1 + nature / 5 by a tenth
+// and lowers the one at 1 + nature % 5, so the diagonal is neutral. in tenths.
+enum {
+	NATURE_COUNT = 25
+};
+
+const uint8_t nature_multiplier[NATURE_COUNT][STAT_COUNT] = {
+	{ 10, 10, 10, 10, 10, 10 }, // Hardy
+	{ 10, 11, 9, 10, 10, 10 }, // Lonely
+	{ 10, 11, 10, 9, 10, 10 }, // Brave
+	{ 10, 11, 10, 10, 9, 10 }, // Adamant
+	{ 10, 11, 10, 10, 10, 9 }, // Naughty
+	{ 10, 9, 11, 10, 10, 10 }, // Bold
+	{ 10, 10, 10, 10, 10, 10 }, // Docile
+	{ 10, 10, 11, 9, 10, 10 }, // Relaxed
+	{ 10, 10, 11, 10, 9, 10 }, // Impish
+	{ 10, 10, 11, 10, 10, 9 }, // Lax
+	{ 10, 9, 10, 11, 10, 10 }, // Timid
+	{ 10, 10, 9, 11, 10, 10 }, // Hasty
+	{ 10, 10, 10, 10, 10, 10 }, // Serious
+	{ 10, 10, 10, 11, 9, 10 }, // Jolly
+	{ 10, 10, 10, 11, 10, 9 }, // Naive
+	{ 10, 9, 10, 10, 11, 10 }, // Modest
+	{ 10, 10, 9, 10, 11, 10 }, // Mild
+	{ 10, 10, 10, 9, 11, 10 }, // Quiet
+	{ 10, 10, 10, 10, 10, 10 }, // Bashful
+	{ 10, 10, 10, 10, 11, 9 }, // Rash
+	{ 10, 9, 10, 10, 10, 11 }, // Calm
+	{ 10, 10, 9, 10, 10, 11 }, // Gentle
+	{ 10, 10, 10, 9, 10, 11 }, // Sassy
+	{ 10, 10, 10, 10, 9, 11 }, // Careful
+	{ 10, 10, 10, 10, 10, 10 }, // Quirky
+};
+
+struct Stats {
+	uint16_t stat[STAT_COUNT];
+};
+
+enum {
+	STAT_BATCH = 64
+};
+
+// the stats the game would calculate, in the game's own integer math. the
+// first pass does the unshuffling and table lookups for a batch, the second is
+// straight arithmetic over flat arrays with nothing left to branch on.
+void compute_stats(struct Stats *out, const uint8_t *const *pokemon, const uint8_t *levels, const size_t count) {
+	for (size_t first = 0; first < count; first += STAT_BATCH) {
+		const size_t batch = count - first < STAT_BATCH ? count - first : STAT_BATCH;
+		uint16_t base[STAT_BATCH][STAT_COUNT];
+		uint16_t iv[STAT_BATCH][STAT_COUNT];
+		uint16_t ev[STAT_BATCH][STAT_COUNT];
+		const uint8_t *multiplier[STAT_BATCH];
+		uint32_t level[STAT_BATCH];
+
+		for (size_t i = 0; i < batch; i++) {
+			const uint8_t *data = pokemon[first + i];
+			union PokemonData raw_data;
+			unshuffle_pokemon(&raw_data, data);
+
+			uint16_t species;
+			memcpy(&species, raw_data.data_g, 2);
+			const struct Pokemon *info = species_info(species);
+			uint32_t personality, ivs;
+			memcpy(&personality, data, 4);
+			memcpy(&ivs, raw_data.data_m + 4, 4);
+
+			for (int s = 0; s < STAT_COUNT; s++) {
+				base[i][s] = info ? info->base[s] : 0;
+				iv[i][s] = ivs >> (s * 5) & 31;
+				ev[i][s] = raw_data.data_e[s];
+			}
+			multiplier[i] = nature_multiplier[personality % NATURE_COUNT];
+			level[i] = levels[first + i];
 		}
 
-		uint32_t key = info.pokemon[i].ot_id ^ info.pokemon[i].personality;
-		for (int i = 0; i < 12; i++) {
-			raw_data.data[i] ^= key;
+		for (size_t i = 0; i < batch; i++) {
+			struct Stats *stats = &out[first + i];
+			const uint32_t hp = (2 * base[i][STAT_HP] + iv[i][STAT_HP] + ev[i][STAT_HP] / 4) * level[i] / 100;
+			// shedinja, the only base 1 hp, always has 1 hp
+			stats->stat[STAT_HP] = base[i][STAT_HP] == 1 ? 1 : hp + level[i] + 10;
+			for (int s = STAT_ATTACK; s < STAT_COUNT; s++) {
+				const uint32_t stat = (2 * base[i][s] + iv[i][s] + ev[i][s] / 4) * level[i] / 100 + 5;
+				stats->stat[s] = stat * multiplier[i][s] / 10;
+			}
 		}
+	}
+}
 
-		//printf("DUMP\n\n\n");
-		//for (int i = 0; i < 12; i++) {
-		//	uint32_t *p = pokemon + TRICKY_DATA + i * 4;
-		//	printf("%08x\n", key ^ (*p));
-		//}
-		//printf("DUMP\n\n");
+// the experience a level starts at. these are the formulas the game's tables
+// were generated from, in the same integer math, so they agree to the point.
+uint32_t experience_for_level(const enum growth_rate growth, const uint32_t n) {
+	if (n <= 1)
+		return 0;
+	switch (growth) {
+		case GROWTH_ERRATIC:
+			if (n <= 50)
+				return (100 - n) * n * n * n / 50;
+			if (n <= 68)
+				return (150 - n) * n * n * n / 100;
+			if (n <= 98)
+				return (1911 - 10 * n) / 3 * n * n * n / 500;
+			return (160 - n) * n * n * n / 100;
+		case GROWTH_FLUCTUATING:
+			if (n <= 15)
+				return ((n + 1) / 3 + 24) * n * n * n / 50;
+			if (n <= 36)
+				return (n + 14) * n * n * n / 50;
+			return (n / 2 + 32) * n * n * n / 50;
+		case GROWTH_MEDIUM_SLOW:
+			return 6 * n * n * n / 5 - 15 * n * n + 100 * n - 140;
+		case GROWTH_FAST:
+			return 4 * n * n * n / 5;
+		case GROWTH_SLOW:
+			return 5 * n * n * n / 4;
+		case GROWTH_MEDIUM_FAST:
+		default:
+			return n * n * n;
+	}
+}
+
+// boxed pokemon don't store a level, the game works it out from experience
+// whenever they leave the pc. anything past the level 100 mark is still 100.
+uint8_t level_from_experience(const enum growth_rate growth, const uint32_t experience) {
+	uint32_t low = 1, high = 100;
+	while (low < high) {
+		const uint32_t mid = (low + high + 1) / 2;
+		if (experience >= experience_for_level(growth, mid))
+			low = mid;
+		else
+			high = mid - 1;
+	}
+	return low;
+}
 
-		//printf("%08x %08x %08x (xor %08x)\n", raw_data.data[0], raw_data.data[1], raw_data.data[2], key);
+// eggs store the species they will hatch into. the game's own entry for an
+// egg is only used for display.
+enum {
+	SPECIES_EGG = 412
+};
 
-		uint16_t species;
-		memcpy(&species, raw_data.data_g, 2);
+bool pokemon_is_egg(const union PokemonData *raw_data) {
+	uint32_t ivs;
+	memcpy(&ivs, raw_data->data_m + 4, 4);
+	return ivs >> 30 & 1; // bit 31 is the ability
+}
+
+uint8_t pokemon_level(const union PokemonData *raw_data) {
+	uint16_t species;
+	uint32_t experience;
+	memcpy(&species, raw_data->data_g, 2);
+	memcpy(&experience, raw_data->data_g + 4, 4);
+	const struct Pokemon *info = species_info(species);
+	return level_from_experience(info ? info->growth : GROWTH_MEDIUM_FAST, experience);
+}
+
+enum pocket {
+	POCKET_PC,
+	POCKET_ITEMS,
+	POCKET_KEY,
+	POCKET_BALLS,
+	POCKET_TM,
+	POCKET_BERRIES,
+	POCKET_COUNT
+};
+
+const char *pocket_names[POCKET_COUNT] = {
+	"pc",
+	"items",
+	"key items",
+	"balls",
+	"tm/hm",
+	"berries"
+};
+
+struct ItemSlot {
+	uint16_t id;
+	uint16_t quantity;
+};
 
-		struct Pokemon poke = pokemon_lut[species];
+struct Pocket {
+	uint32_t count; // non-empty slots, packed at the front of items
+	struct ItemSlot items[64];
+};
 
-		printf("species %d (%04x), %s should be a %s order %d, personality %d\n", species, species, info.pokemon[i].nickname, poke.name, order, info.pokemon[i].personality);
-		//printf("\n");
+// each slot is (id, quantity) as two little endian halfwords, so one 32 bit
+// mask with the key in the top half unmasks a whole slot.
+void unmask_items_scalar(struct ItemSlot *out, const uint8_t *in, const size_t count, const uint16_t key) {
+	const uint32_t mask = (uint32_t)key << 16;
+	for (size_t i = 0; i < count; i++) {
+		uint32_t slot;
+		memcpy(&slot, in + i * 4, 4);
+		slot ^= mask;
+		memcpy(&out[i], &slot, 4);
 	}
+}
 
-	printf("money $%d\n", info.money ^ sec_key);
+void unmask_items(struct ItemSlot *out, const uint8_t *in, const size_t count, const uint16_t key) {
+#ifdef __SSE2__
+	const __m128i mask = _mm_set1_epi32((uint32_t)key << 16);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i slots = _mm_loadu_si128((const __m128i *)(in + i * 4));
+		_mm_storeu_si128((__m128i *)&out[i], _mm_xor_si128(slots, mask));
+	}
+	unmask_items_scalar(out + i, in + i * 4, count - i, key);
+#else
+	unmask_items_scalar(out, in, count, key);
+#endif
 }
 
-int main(int argc, char **argv) {
-	struct stat s;
+void decode_items(struct Pocket *pockets, const uint8_t *base, const uint32_t sec_key) {
+	const struct {
+		uint16_t offset;
+		uint16_t slots;
+	} layout[POCKET_COUNT] = {
+		[POCKET_PC] = { 0x498, 50 },
+		[POCKET_ITEMS] = { 0x560, 30 },
+		[POCKET_KEY] = { 0x5D8, 30 },
+		[POCKET_BALLS] = { 0x650, 16 },
+		[POCKET_TM] = { 0x690, 64 },
+		[POCKET_BERRIES] = { 0x790, 46 }
+	};
 
-	if (argc <= 1) {
-		fprintf(stderr, "provide a sav file please");
-		exit(-1);
+	for (int p = 0; p < POCKET_COUNT; p++) {
+		struct Pocket *pocket = &pockets[p];
+		// pc items are stored in the clear
+		const uint16_t key = p == POCKET_PC ? 0 : sec_key & 0xFFFF;
+		unmask_items(pocket->items, base + layout[p].offset, layout[p].slots, key);
+
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < layout[p].slots; i++) {
+			if (pocket->items[i].id != 0)
+				pocket->items[count++] = pocket->items[i];
+		}
+		pocket->count = count;
 	}
+}
 
-	printf("loading %s\n", argv[1]);
+enum {
+	SAVE_SLOT_SIZE = 0xE000,
+	SAVE_MIN_SIZE = 2 * SAVE_SLOT_SIZE,
+	SAVE_MAX_SIZE = 0x20000 + 0x1000, // some emulators tack rtc data onto the end
+	SECTION_SIZE = 4096,
+	SECTION_COUNT = 14
+};
 
-	const char *file_name = argv[1];
-	int fd = open(file_name, O_RDONLY);
-	check(fd < 0, "open %s failed: %s", file_name, strerror(errno));
+enum {
+	TRAINER_INFO,
+	TEAM_ITEMS,
+	GAME_STATE,
+	MISC_DATA,
+	RIVAL_INFO,
+	PC_A,
+	PC_B,
+	PC_C,
+	PC_D,
+	PC_E,
+	PC_F,
+	PC_G,
+	PC_H,
+	PC_I,
+};
 
-	int status = fstat(fd, &s);
-	check(status < 0, "stat %s failed: %s", file_name, strerror(errno));
-	size_t size = s.st_size;
+struct SaveOffsets {
+	size_t trainer_info;
+	size_t team_items;
+	size_t game_state;
+	size_t misc_data;
+	size_t rival_info;
+	size_t pc_box[9];
+	size_t hall_of_fame; // from the active slot, 0 if the file stops short of it
+};
 
-	const uint8_t *mapped = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
-	check(mapped == MAP_FAILED, "mmap %s failed: %s", file_name, strerror(errno));
+// the hall of fame lives in its own two sectors after both save slots
+enum {
+	HALL_OF_FAME_OFFSET = 0x1C000,
+	HALL_OF_FAME_END = HALL_OF_FAME_OFFSET + 2 * SECTION_SIZE
+};
 
-	const uint8_t *base_saves[] = {
-		mapped,
-		mapped + 0xE000
-	};
+size_t hall_of_fame_offset(const size_t size, const size_t slot) {
+	return size >= HALL_OF_FAME_END ? HALL_OF_FAME_OFFSET - slot : 0;
+}
+
+void offsets_to_sections(uint16_t *sections, const struct SaveOffsets *offsets) {
+	sections[TRAINER_INFO] = offsets->trainer_info;
+	sections[TEAM_ITEMS] = offsets->team_items;
+	sections[GAME_STATE] = offsets->game_state;
+	sections[MISC_DATA] = offsets->misc_data;
+	sections[RIVAL_INFO] = offsets->rival_info;
+	for (int i = 0; i < 9; i++) {
+		sections[PC_A + i] = offsets->pc_box[i];
+	}
+}
+
+void sections_to_offsets(struct SaveOffsets *offsets, const uint16_t *sections) {
+	offsets->trainer_info = sections[TRAINER_INFO];
+	offsets->team_items = sections[TEAM_ITEMS];
+	offsets->game_state = sections[GAME_STATE];
+	offsets->misc_data = sections[MISC_DATA];
+	offsets->rival_info = sections[RIVAL_INFO];
+	for (int i = 0; i < 9; i++) {
+		offsets->pc_box[i] = sections[PC_A + i];
+	}
+}
+
+// why a file was turned away, checked once up front so the decoders never
+// need to bounds check anything themselves
+enum save_error {
+	SAVE_OK,
+	SAVE_TOO_SMALL,
+	SAVE_TOO_LARGE,
+	SAVE_BAD_SIGNATURE,
+	SAVE_BAD_SECTION_ID,
+	SAVE_DUPLICATE_SECTION,
+	SAVE_MISSING_SECTION,
+	SAVE_BAD_CHECKSUM,
+	SAVE_ERROR_COUNT
+};
+
+const char *save_error_names[SAVE_ERROR_COUNT] = {
+	"ok",
+	"too small",
+	"too large",
+	"bad section signature",
+	"bad section id",
+	"duplicate section",
+	"missing section",
+	"bad section checksum"
+};
+
+const uint16_t section_data_size[SECTION_COUNT] = {
+	3884, 3968, 3968, 3968, 3848, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 2000
+};
+
+uint16_t section_checksum_scalar(const uint8_t *section, const size_t size) {
+	uint32_t sum = 0;
+	for (size_t i = 0; i < size; i += 4) {
+		uint32_t word;
+		memcpy(&word, section + i, 4);
+		sum += word;
+	}
+	return (sum >> 16) + sum;
+}
+
+// every section of both slots gets summed before anything is decoded, so this
+// is most of the cost of validating a file. addition wraps the same in any
+// order, so four lanes of partial sums give the same answer.
+uint16_t section_checksum(const uint8_t *section, const size_t size) {
+#ifdef __SSE2__
+	__m128i lanes = _mm_setzero_si128();
+	size_t i = 0;
+	for (; i + 16 <= size; i += 16) {
+		lanes = _mm_add_epi32(lanes, _mm_loadu_si128((const __m128i *)(section + i)));
+	}
+	uint32_t partial[4];
+	_mm_storeu_si128((__m128i *)partial, lanes);
+	uint32_t sum = partial[0] + partial[1] + partial[2] + partial[3];
+	for (; i < size; i += 4) {
+		uint32_t word;
+		memcpy(&word, section + i, 4);
+		sum += word;
+	}
+	return (sum >> 16) + sum;
+#else
+	return section_checksum_scalar(section, size);
+#endif
+}
 
+// every section of a slot has to be there exactly once, or unseen sections
+// would alias section 0. their checksums have to hold too, which is what
+// the game goes by when it picks a slot.
+enum save_error validate_slot(const uint8_t *slot, uint16_t *sections) {
 	enum {
 		OFFSET_SECTION_ID = 0xFF4,
 		OFFSET_CHECKSUM = 0xFF6,
-		OFFSET_SAVE_INDEX = 0xFFC
+		OFFSET_SIGNATURE = 0xFF8,
+		SECTION_SIGNATURE = 0x08012025,
+		ALL_SECTIONS = (1 << SECTION_COUNT) - 1
 	};
 
+	uint32_t seen = 0, duplicate = 0, bad_id = 0, bad_signature = 0, bad_checksum = 0;
+	for (size_t i = 0; i < SECTION_COUNT; i++) {
+		const size_t offset = i * SECTION_SIZE;
+		uint16_t id, checksum;
+		uint32_t signature;
+		memcpy(&id, slot + offset + OFFSET_SECTION_ID, 2);
+		memcpy(&checksum, slot + offset + OFFSET_CHECKSUM, 2);
+		memcpy(&signature, slot + offset + OFFSET_SIGNATURE, 4);
+		if (id < SECTION_COUNT)
+			bad_checksum |= section_checksum(slot + offset, section_data_size[id]) != checksum;
+
+		// out of range ids land in a spare bit and slot rather than branching
+		const uint32_t index = id < SECTION_COUNT ? id : SECTION_COUNT;
+		const uint32_t bit = 1u << index;
+		bad_id |= id >= SECTION_COUNT;
+		bad_signature |= signature != SECTION_SIGNATURE;
+		duplicate |= seen & bit;
+		seen |= bit;
+		sections[index] = offset;
+	}
+
+	if (bad_signature)
+		return SAVE_BAD_SIGNATURE;
+	if (bad_id)
+		return SAVE_BAD_SECTION_ID;
+	if (duplicate)
+		return SAVE_DUPLICATE_SECTION;
+	if (seen != ALL_SECTIONS)
+		return SAVE_MISSING_SECTION;
+	if (bad_checksum)
+		return SAVE_BAD_CHECKSUM;
+	return SAVE_OK;
+}
+
+// picks the most recent of the two save slots and finds where each section
+// ended up. if the newer slot is broken (half written so its checksums fail,
+// or never written at all and still 0xFF) the older one is used instead.
+enum save_error locate_save(const uint8_t *mapped, const size_t size, const uint8_t **save, struct SaveOffsets *offsets, bool *slot_a) {
 	enum {
-		TRAINER_INFO,
-		TEAM_ITEMS,
-		GAME_STATE,
-		MISC_DATA,
-		RIVAL_INFO,
-		PC_A,
-		PC_B,
-		PC_C,
-		PC_D,
-		PC_E,
-		PC_F,
-		PC_G,
-		PC_H,
-		PC_I,
+		OFFSET_SAVE_INDEX = 0xFFC
+	};
+
+	if (size < SAVE_MIN_SIZE)
+		return SAVE_TOO_SMALL;
+	if (size > SAVE_MAX_SIZE)
+		return SAVE_TOO_LARGE;
+
+	const uint8_t *base_saves[] = {
+		mapped,
+		mapped + SAVE_SLOT_SIZE
 	};
 
 	uint32_t save_idx_a, save_idx_b;
 	memcpy(&save_idx_a, base_saves[0] + OFFSET_SAVE_INDEX, 4);
 	memcpy(&save_idx_b, base_saves[1] + OFFSET_SAVE_INDEX, 4);
-	const uint8_t *save = (save_idx_a > save_idx_b) ? base_saves[0] : base_saves[1];
-	if (save_idx_a > save_idx_b) {
-		printf("save A selected\n");
-	}
-	else {
-		printf("save B selected\n");
-	}
+	*slot_a = save_idx_a > save_idx_b;
 
-	struct {
-		size_t trainer_info;
-		size_t team_items;
-		size_t game_state;
-		size_t misc_data;
-		size_t rival_info;
-		size_t pc_box[9];
-	} offsets;
-	memset(&offsets, 0, sizeof(offsets));
-
-	for (size_t i = 0; i < 14; i++) {
-		const size_t offset = i * 4096;
-		uint16_t id;
-		memcpy(&id, save + offset + OFFSET_SECTION_ID, 2);
-		switch (id) {
-			case TRAINER_INFO: offsets.trainer_info = offset; break;
-			case TEAM_ITEMS: offsets.team_items = offset; break;
-			case GAME_STATE: offsets.game_state = offset;  break;
-			case MISC_DATA: offsets.misc_data = offset; break;
-			case RIVAL_INFO: offsets.rival_info = offset; break;
-			case PC_A: offsets.pc_box[0] = offset; break;
-			case PC_B: offsets.pc_box[1] = offset; break;
-			case PC_C: offsets.pc_box[2] = offset; break;
-			case PC_D: offsets.pc_box[3] = offset; break;
-			case PC_E: offsets.pc_box[4] = offset; break;
-			case PC_F: offsets.pc_box[5] = offset; break;
-			case PC_G: offsets.pc_box[6] = offset; break;
-			case PC_H: offsets.pc_box[7] = offset; break;
-			case PC_I: offsets.pc_box[8] = offset; break;
-			default: break;
-		};
+	uint16_t sections[SECTION_COUNT + 1];
+	enum save_error error = validate_slot(base_saves[!*slot_a], sections);
+	if (error != SAVE_OK) {
+		if (validate_slot(base_saves[*slot_a], sections) != SAVE_OK)
+			return error;
+		*slot_a = !*slot_a;
 	}
 
+	*save = base_saves[!*slot_a];
+	sections_to_offsets(offsets, sections);
+	offsets->hall_of_fame = hall_of_fame_offset(size, *save - mapped);
+	return SAVE_OK;
+}
+
+enum {
+	SAVEBLOCK2_KEY = 0xAC // 4, emerald's encryption key, in the file and in EWRAM alike
+};
+
+uint32_t read_sec_key(const uint8_t *save, const struct SaveOffsets *offsets) {
 	uint32_t sec_key;
-	memcpy(&sec_key, save + offsets.trainer_info + 0x1F4, 4);
+	memcpy(&sec_key, save + offsets->trainer_info + SAVEBLOCK2_KEY, 4);
+	return sec_key;
+}
 
-	uint32_t money;
-	memcpy(&money, save + offsets.trainer_info + 0x490, 4);
+// the pc buffer is split across sections 5-13, 3968 bytes in each
+enum {
+	PC_SECTION_DATA = 3968,
+	PC_CURRENT_BOX = 0,     // 4
+	PC_POKEMON = 4,         // 33600
+	PC_BOX_NAMES = 0x8344,  // 126
+	PC_WALLPAPERS = 0x83C2, // 14
+	BOX_COUNT = 14,
+	BOX_SLOTS = 30,
+	PC_POKEMON_COUNT = BOX_COUNT * BOX_SLOTS,
+	PC_SPLIT_MAX = 8 // records straddling a section boundary, one per boundary at most
+};
+
+void read_pc(uint8_t *out, const uint8_t *save, const struct SaveOffsets *offsets, size_t pc_offset, size_t len) {
+	while (len > 0) {
+		const size_t section = pc_offset / PC_SECTION_DATA;
+		const size_t within = pc_offset % PC_SECTION_DATA;
+		size_t chunk = PC_SECTION_DATA - within;
+		if (chunk > len)
+			chunk = len;
+		memcpy(out, save + offsets->pc_box[section] + within, chunk);
+		out += chunk;
+		pc_offset += chunk;
+		len -= chunk;
+	}
+}
+
+// empty box slots are all zero, which checksums fine but isn't worth printing
+bool pokemon_present(const uint8_t *pokemon) {
+	uint32_t personality, ot_id;
+	memcpy(&personality, pokemon, 4);
+	memcpy(&ot_id, pokemon + 4, 4);
+	return personality != 0 || ot_id != 0;
+}
+
+// everything not worth a hand written decoder is described here instead, one
+// line per field: where it lives, how wide it is and how it's stored. the
+// table drives dump_fields and also generates an inline accessor per field
+// (field_money(view, 0) and so on) which folds down to a single load.
+//
+// offsets are into the game's structures rather than into save sections:
+// save block 1 is split over sections 1-4 and the pc and hall of fame are
+// each split over several sections, 3968 bytes at a time. these are all
+// emerald's layouts.
+enum field_source {
+	SAVEBLOCK2,   // section 0
+	SAVEBLOCK1,   // sections 1-4
+	PC,           // sections 5-13
+	HALL_OF_FAME  // sectors 28-29, outside the save slots
+};
+
+enum field_encoding {
+	PLAIN,   // little endian integer
+	KEYED,   // integer xored with the security key
+	TEXT,    // game text, width characters
+	FLAGS,   // one bit per element starting at bit `shift`
+	BITS,    // `bits` wide at `shift` inside a little endian integer
+	SPECIES  // an 80 byte boxed pokemon, read as its species
+};
+
+enum {
+	FIELD_SPARSE = 1,  // arrays that are mostly empty, only print non-zero elements
+	FIELD_DECODED = 2  // read by a structured decoder and printed by its dump, not dump_fields
+};
+
+//  name                  source        offset  width encoding shift bits count stride flags
+#define SAVE_FIELDS(X) \
+	X(player_name,          SAVEBLOCK2,   0x0000, 7,    TEXT,    0,    0,   1,    0,     FIELD_DECODED) \
+	X(player_gender,        SAVEBLOCK2,   0x0008, 1,    PLAIN,   0,    0,   1,    0,     FIELD_DECODED) \
+	X(trainer_id,           SAVEBLOCK2,   0x000A, 2,    PLAIN,   0,    0,   1,    0,     FIELD_DECODED) \
+	X(secret_id,            SAVEBLOCK2,   0x000C, 2,    PLAIN,   0,    0,   1,    0,     0) \
+	X(play_hours,           SAVEBLOCK2,   0x000E, 2,    PLAIN,   0,    0,   1,    0,     0) \
+	X(play_minutes,         SAVEBLOCK2,   0x0010, 1,    PLAIN,   0,    0,   1,    0,     0) \
+	X(play_seconds,         SAVEBLOCK2,   0x0011, 1,    PLAIN,   0,    0,   1,    0,     0) \
+	X(dex_owned,            SAVEBLOCK2,   0x0028, 1,    FLAGS,   0,    0,   386,  0,     FIELD_DECODED) \
+	X(dex_seen,             SAVEBLOCK2,   0x005C, 1,    FLAGS,   0,    0,   386,  0,     FIELD_DECODED) \
+	X(frontier_bp,          SAVEBLOCK2,   0x0EB8, 2,    PLAIN,   0,    0,   1,    0,     0) \
+	X(frontier_bp_earned,   SAVEBLOCK2,   0x0EBA, 2,    PLAIN,   0,    0,   1,    0,     0) \
+	X(team_size,            SAVEBLOCK1,   0x0234, 4,    PLAIN,   0,    0,   1,    0,     FIELD_DECODED) \
+	X(party,                SAVEBLOCK1,   0x0238, 100,  SPECIES, 0,    0,   6,    100,   FIELD_DECODED) \
+	X(money,                SAVEBLOCK1,   0x0490, 4,    KEYED,   0,    0,   1,    0,     FIELD_DECODED) \
+	X(coins,                SAVEBLOCK1,   0x0494, 2,    KEYED,   0,    0,   1,    0,     FIELD_DECODED) \
+	X(dex_seen_b,           SAVEBLOCK1,   0x0988, 1,    FLAGS,   0,    0,   386,  0,     FIELD_SPARSE) \
+	X(badges,               SAVEBLOCK1,   0x1270, 1,    FLAGS,   0x867, 0,  8,    0,     FIELD_DECODED) \
+	X(game_stats,           SAVEBLOCK1,   0x159C, 4,    KEYED,   0,    0,   64,   4,     FIELD_SPARSE) \
+	X(daycare,              SAVEBLOCK1,   0x3030, 80,   SPECIES, 0,    0,   2,    0x8C,  FIELD_SPARSE) \
+	X(dex_seen_c,           SAVEBLOCK1,   0x3B24, 1,    FLAGS,   0,    0,   386,  0,     FIELD_SPARSE) \
+	X(current_box,          PC,           0x0000, 1,    PLAIN,   0,    0,   1,    0,     0) \
+	X(box_names,            PC,           0x8344, 8,    TEXT,    0,    0,   14,   9,     0) \
+	X(box_wallpapers,       PC,           0x83C2, 1,    PLAIN,   0,    0,   14,   1,     0) \
+	X(fame_trainer_id,      HALL_OF_FAME, 0x0000, 4,    PLAIN,   0,    0,   300,  20,    FIELD_SPARSE) \
+	X(fame_species,         HALL_OF_FAME, 0x0008, 2,    BITS,    0,    9,   300,  20,    FIELD_SPARSE) \
+	X(fame_level,           HALL_OF_FAME, 0x0008, 2,    BITS,    9,    7,   300,  20,    FIELD_SPARSE) \
+	X(fame_nickname,        HALL_OF_FAME, 0x000A, 10,   TEXT,    0,    0,   300,  20,    FIELD_SPARSE)
+
+struct Field {
+	const char *name;
+	enum field_source source;
+	uint16_t offset;
+	uint8_t width;
+	enum field_encoding encoding;
+	uint16_t shift;
+	uint8_t bits;
+	uint16_t count;
+	uint16_t stride;
+	uint8_t flags;
+};
+
+#define FIELD_ENTRY(name, source, offset, width, encoding, shift, bits, count, stride, flags) \
+	{ #name, source, offset, width, encoding, shift, bits, count, stride, flags },
+const struct Field save_fields[] = {
+	SAVE_FIELDS(FIELD_ENTRY)
+};
+#undef FIELD_ENTRY
+
+struct FieldView {
+	const uint8_t *save;
+	const struct SaveOffsets *offsets;
+	uint32_t sec_key;
+};
 
-	dump_trainer_info(save + offsets.trainer_info);
-	dump_team_info(save + offsets.team_items, sec_key);
-	dump_game_flags(save + offsets.game_state);
+enum {
+	FIELD_CHUNK = 3968 // data bytes per section for every split structure
+};
 
+// where chunk n of a source starts, relative to the active slot
+static inline size_t field_chunk(const struct FieldView *view, const enum field_source source, const size_t chunk) {
+	const struct SaveOffsets *offsets = view->offsets;
+	switch (source) {
+		case SAVEBLOCK2: return offsets->trainer_info;
+		case SAVEBLOCK1: {
+			const size_t sections[] = { offsets->team_items, offsets->game_state, offsets->misc_data, offsets->rival_info };
+			return sections[chunk];
+		}
+		case PC: return offsets->pc_box[chunk];
+		case HALL_OF_FAME: return offsets->hall_of_fame + chunk * SECTION_SIZE;
+	}
 	return 0;
 }
+
+static inline bool field_present(const struct FieldView *view, const enum field_source source) {
+	return source != HALL_OF_FAME || view->offsets->hall_of_fame != 0;
+}
+
+// copies len bytes from offset in the source. with constant arguments the
+// common case of a field sitting inside one section is a plain memcpy.
+static inline void field_bytes(uint8_t *out, const struct FieldView *view, const enum field_source source, size_t offset, size_t len) {
+	while (len > 0) {
+		const size_t within = offset % FIELD_CHUNK;
+		size_t chunk = FIELD_CHUNK - within;
+		if (chunk > len)
+			chunk = len;
+		memcpy(out, view->save + field_chunk(view, source, offset / FIELD_CHUNK) + within, chunk);
+		out += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+}
+
+static inline uint32_t field_value(const struct FieldView *view, const enum field_source source, const uint16_t offset,
+	const uint8_t width, const enum field_encoding encoding, const uint16_t shift, const uint8_t bits,
+	const uint16_t stride, const int index) {
+	if (encoding == FLAGS) {
+		const uint32_t bit = shift + index;
+		uint8_t byte;
+		field_bytes(&byte, view, source, offset + (bit >> 3), 1);
+		return byte >> (bit & 7) & 1;
+	}
+
+	if (encoding == SPECIES) {
+		uint8_t pokemon[BOX_POKEMON_SIZE];
+		field_bytes(pokemon, view, source, offset + index * stride, BOX_POKEMON_SIZE);
+		const uint8_t *record = pokemon;
+		bool valid;
+		if (!pokemon_present(pokemon) || check_pokemon(&valid, &record, 1))
+			return 0;
+		union PokemonData raw_data;
+		unshuffle_pokemon(&raw_data, pokemon);
+		uint16_t species;
+		memcpy(&species, raw_data.data_g, 2);
+		return species;
+	}
+
+	uint32_t value = 0;
+	field_bytes((uint8_t *)&value, view, source, offset + index * stride, width);
+	if (encoding == KEYED)
+		value ^= width == 4 ? view->sec_key : view->sec_key & ((1u << width * 8) - 1);
+	if (encoding == BITS)
+		value = value >> shift & ((1u << bits) - 1);
+	return value;
+}
+
+static inline void field_text(uint8_t *out, const struct FieldView *view, const enum field_source source,
+	const uint16_t offset, const uint8_t width, const uint16_t stride, const int index) {
+	uint8_t raw[255];
+	field_bytes(raw, view, source, offset + index * stride, width);
+	decode_text(out, raw, width);
+}
+
+// one accessor per row, picked by its encoding: field_text_<name>() for text,
+// field_<name>() for everything that decodes to a number. flags rows also get
+// field_flags_<name>() to copy the whole bitmap, and pokemon rows get
+// field_record_<name>() to point at a record in place.
+#define FIELD_VALUE_ACCESSOR(name, source, offset, width, encoding, shift, bits, count, stride) \
+	static inline uint32_t field_##name(const struct FieldView *view, const int index) { \
+		return field_value(view, source, offset, width, encoding, shift, bits, stride, index); \
+	}
+#define FIELD_ACCESSOR_PLAIN FIELD_VALUE_ACCESSOR
+#define FIELD_ACCESSOR_KEYED FIELD_VALUE_ACCESSOR
+#define FIELD_ACCESSOR_BITS FIELD_VALUE_ACCESSOR
+#define FIELD_ACCESSOR_FLAGS(name, source, offset, width, encoding, shift, bits, count, stride) \
+	FIELD_VALUE_ACCESSOR(name, source, offset, width, encoding, shift, bits, count, stride) \
+	static inline void field_flags_##name(uint8_t *out, const struct FieldView *view) { \
+		field_bytes(out, view, source, offset, (shift + count + 7) / 8); \
+	}
+#define FIELD_ACCESSOR_SPECIES(name, source, offset, width, encoding, shift, bits, count, stride) \
+	FIELD_VALUE_ACCESSOR(name, source, offset, width, encoding, shift, bits, count, stride) \
+	static inline const uint8_t *field_record_##name(const struct FieldView *view, const int index) { \
+		_Static_assert(offset % FIELD_CHUNK + (count - 1) * stride + width <= FIELD_CHUNK, #name " is split across sections"); \
+		return view->save + field_chunk(view, source, offset / FIELD_CHUNK) + offset % FIELD_CHUNK + index * stride; \
+	}
+#define FIELD_ACCESSOR_TEXT(name, source, offset, width, encoding, shift, bits, count, stride) \
+	static inline void field_text_##name(uint8_t *out, const struct FieldView *view, const int index) { \
+		field_text(out, view, source, offset, width, stride, index); \
+	}
+#define FIELD_ACCESSOR(name, source, offset, width, encoding, shift, bits, count, stride, flags) \
+	FIELD_ACCESSOR_##encoding(name, source, offset, width, encoding, shift, bits, count, stride)
+SAVE_FIELDS(FIELD_ACCESSOR)
+#undef FIELD_ACCESSOR
+
+// where each row starts in its source, for code that lays out a save block
+// rather than reading one
+#define FIELD_OFFSET(name, source, offset, width, encoding, shift, bits, count, stride, flags) \
+	FIELD_OFFSET_##name = offset,
+enum {
+	SAVE_FIELDS(FIELD_OFFSET)
+};
+#undef FIELD_OFFSET
+
+// pointers to every boxed pokemon. most point straight into the save, the few
+// split across two sections get stitched together in split.
+struct PcPokemon {
+	const uint8_t *pokemon[PC_POKEMON_COUNT];
+	uint8_t split[PC_SPLIT_MAX][BOX_POKEMON_SIZE];
+};
+
+void gather_pc_pokemon(struct PcPokemon *pc, const uint8_t *save, const struct SaveOffsets *offsets) {
+	size_t split = 0;
+	for (size_t i = 0; i < PC_POKEMON_COUNT; i++) {
+		const size_t pc_offset = PC_POKEMON + i * BOX_POKEMON_SIZE;
+		const size_t within = pc_offset % PC_SECTION_DATA;
+		if (within + BOX_POKEMON_SIZE <= PC_SECTION_DATA) {
+			pc->pokemon[i] = save + offsets->pc_box[pc_offset / PC_SECTION_DATA] + within;
+		}
+		else {
+			read_pc(pc->split[split], save, offsets, pc_offset, BOX_POKEMON_SIZE);
+			pc->pokemon[i] = pc->split[split++];
+		}
+	}
+}
+
+enum {
+	ALL_POKEMON_MAX = 6 + PC_POKEMON_COUNT
+};
+
+// party followed by every box slot, returns how many. only the first 80 bytes
+// of party entries are the boxed format, the rest is battle stats.
+size_t gather_all_pokemon(const uint8_t **pokemon, struct PcPokemon *pc, const uint8_t *save, const struct SaveOffsets *offsets) {
+	const struct FieldView view = { save, offsets, 0 };
+	uint32_t team_size = field_team_size(&view, 0);
+	if (team_size > 6)
+		team_size = 6;
+	for (uint32_t i = 0; i < team_size; i++) {
+		pokemon[i] = field_record_party(&view, i);
+	}
+
+	gather_pc_pokemon(pc, save, offsets);
+	memcpy(pokemon + team_size, pc->pokemon, sizeof(pc->pokemon));
+
+	return team_size + PC_POKEMON_COUNT;
+}
+
+// a record that checksums, isn't an empty slot and has a species we know
+struct PokemonRecord {
+	const uint8_t *pokemon;
+	size_t index; // into all, so below team_size is the party
+	uint16_t species; // what an egg will hatch into
+	bool egg;
+	union PokemonData raw_data;
+};
+
+// everything the batch visitors start from. all and valid cover every slot,
+// records only the pokemon worth looking at.
+struct SavePokemon {
+	struct PcPokemon pc;
+	const uint8_t *all[ALL_POKEMON_MAX];
+	bool valid[ALL_POKEMON_MAX];
+	size_t all_count;
+	size_t team_size;
+	size_t bad_checksums;
+	size_t bad_species; // checksum fine, species out of range. not in records
+	size_t count;
+	struct PokemonRecord records[ALL_POKEMON_MAX];
+};
+
+void collect_pokemon(struct SavePokemon *out, const uint8_t *save, const struct SaveOffsets *offsets) {
+	out->all_count = gather_all_pokemon(out->all, &out->pc, save, offsets);
+	out->team_size = out->all_count - PC_POKEMON_COUNT;
+	out->bad_checksums = check_pokemon(out->valid, out->all, out->all_count);
+	out->bad_species = 0;
+	out->count = 0;
+
+	for (size_t i = 0; i < out->all_count; i++) {
+		if (!out->valid[i] || !pokemon_present(out->all[i]))
+			continue;
+
+		struct PokemonRecord *record = &out->records[out->count];
+		unshuffle_pokemon(&record->raw_data, out->all[i]);
+		memcpy(&record->species, record->raw_data.data_g, 2);
+		if (!species_info(record->species)) {
+			out->bad_species++;
+			continue;
+		}
+		record->egg = pokemon_is_egg(&record->raw_data);
+		record->pokemon = out->all[i];
+		record->index = i;
+		out->count++;
+	}
+}
+
+// each pc section task decodes the records that start inside it
+struct PcSection {
+	uint16_t first; // index of the first record, counting from box 1 slot 1
+	uint16_t count;
+	struct {
+		uint16_t species;
+		bool present;
+		bool valid;
+		uint8_t nickname[11];
+	} pokemon[PC_SECTION_DATA / BOX_POKEMON_SIZE + 1];
+};
+
+void decode_pc_section(struct PcSection *out, const uint8_t *save, const struct SaveOffsets *offsets, const size_t section) {
+	const size_t begin = section * PC_SECTION_DATA;
+	const size_t end = begin + PC_SECTION_DATA;
+	size_t first = begin > PC_POKEMON ? (begin - PC_POKEMON + BOX_POKEMON_SIZE - 1) / BOX_POKEMON_SIZE : 0;
+	size_t last = (end - PC_POKEMON + BOX_POKEMON_SIZE - 1) / BOX_POKEMON_SIZE;
+	if (last > PC_POKEMON_COUNT)
+		last = PC_POKEMON_COUNT;
+	if (first > last)
+		first = last;
+
+	out->first = first;
+	out->count = last - first;
+
+	const uint8_t *pokemon[PC_SECTION_DATA / BOX_POKEMON_SIZE + 1];
+	bool valid[PC_SECTION_DATA / BOX_POKEMON_SIZE + 1];
+	uint8_t split[BOX_POKEMON_SIZE];
+	for (size_t i = 0; i < out->count; i++) {
+		const size_t pc_offset = PC_POKEMON + (first + i) * BOX_POKEMON_SIZE;
+		const size_t within = pc_offset - begin;
+		if (within + BOX_POKEMON_SIZE <= PC_SECTION_DATA) {
+			pokemon[i] = save + offsets->pc_box[section] + within;
+		}
+		else {
+			// only the last record can run into the next section
+			read_pc(split, save, offsets, pc_offset, BOX_POKEMON_SIZE);
+			pokemon[i] = split;
+		}
+	}
+	check_pokemon(valid, pokemon, out->count);
+
+	for (size_t i = 0; i < out->count; i++) {
+		out->pokemon[i].present = pokemon_present(pokemon[i]);
+		if (!out->pokemon[i].present)
+			continue;
+
+		union PokemonData raw_data;
+		unshuffle_pokemon(&raw_data, pokemon[i]);
+		memcpy(&out->pokemon[i].species, raw_data.data_g, 2);
+		out->pokemon[i].valid = valid[i] && species_info(out->pokemon[i].species);
+		decode_text(out->pokemon[i].nickname, pokemon[i] + 8, 10);
+	}
+}
+
+void dump_pc_info(const struct PcSection *pc) {
+	for (size_t s = 0; s < 9; s++) {
+		for (size_t i = 0; i < pc[s].count; i++) {
+			if (!pc[s].pokemon[i].present)
+				continue;
+
+			const size_t index = pc[s].first + i;
+			const uint16_t species = pc[s].pokemon[i].species;
+			printf("box %zu slot %2zu: ", index / BOX_SLOTS + 1, index % BOX_SLOTS + 1);
+			if (!pc[s].pokemon[i].valid) {
+				printf("bad egg (species %d)\n", species);
+				continue;
+			}
+			printf("%s (%s)\n", species_info(species)->name, pc[s].pokemon[i].nickname);
+		}
+	}
+}
+
+
+// the structured decoders read through the accessors above. they're the only
+// place these fields are printed, so the table marks them FIELD_DECODED.
+// the trainer's own dex. save block 1 keeps two more copies of seen, which
+// only dump_fields looks at.
+void decode_pokedex(struct Pokedex *dex, const struct FieldView *view) {
+	memset(dex, 0, sizeof(*dex));
+	field_flags_dex_owned((uint8_t *)dex->owned, view);
+	field_flags_dex_seen((uint8_t *)dex->seen, view);
+
+	// the last byte has room for 392 entries, drop the 6 that don't exist
+	const uint64_t last_mask = (1ull << (DEX_COUNT - 64 * (DEX_WORDS - 1))) - 1;
+	dex->owned[DEX_WORDS - 1] &= last_mask;
+	dex->seen[DEX_WORDS - 1] &= last_mask;
+}
+
+struct TrainerInfo {
+	uint8_t name[8];
+	bool female;
+	uint32_t trainer_id;
+	struct Pokedex dex;
+};
+
+void decode_trainer_info(struct TrainerInfo *info, const struct FieldView *view) {
+	field_text_player_name(info->name, view, 0);
+	info->female = field_player_gender(view, 0) == 1;
+	info->trainer_id = field_trainer_id(view, 0);
+	decode_pokedex(&info->dex, view);
+}
+
+void dump_trainer_info(const struct TrainerInfo *info) {
+	printf("\n\n");
+	printf("%s\n", info->name);
+	printf("female: %d\n", info->female);
+	printf("trainer id %d\n", info->trainer_id);
+	printf("pokedex owned %d seen %d\n", dex_popcount(info->dex.owned), dex_popcount(info->dex.seen));
+	printf("\n\n");
+}
+
+struct GameFlags {
+	bool badges[8];
+};
+
+void decode_game_flags(struct GameFlags *flags, const struct FieldView *view) {
+	for (int i = 0; i < 8; i++) {
+		flags->badges[i] = field_badges(view, i);
+	}
+}
+
+void dump_game_flags(const struct GameFlags *flags) {
+	for (int i = 0; i < 8; i++) {
+		printf("badge %i = %d\n", i, flags->badges[i]);
+	}
+}
+
+struct TeamInfo {
+	uint32_t team_size;
+	struct {
+		uint32_t personality;
+		uint32_t ot_id;
+		uint8_t nickname[11]; // +1 for terminator
+		uint16_t lang;
+		uint8_t ot_name[8];
+		uint8_t markings;
+		uint16_t checksum;
+		uint16_t unknown;
+		union {
+			//uint8_t data[48];
+			struct {
+				uint8_t data0[12];
+				uint8_t data1[12];
+				uint8_t data2[12];
+				uint8_t data3[12];
+			};
+		};
+		uint32_t status;
+		uint8_t level;
+		uint8_t pokerus;
+		uint16_t current_hp;
+		uint16_t total_hp;
+		uint16_t attack;
+		uint16_t defense;
+		uint16_t speed;
+		uint16_t sp_attack;
+		uint16_t sp_defense;
+		uint16_t species;
+		bool valid; // checksum matches and species is known, otherwise a bad egg
+		bool edited; // stored stats aren't what the game would calculate
+	} pokemon[6];
+	uint32_t money;
+	uint16_t coins;
+	struct Pocket pockets[POCKET_COUNT];
+};
+
+void decode_team_info(struct TeamInfo *info, const struct FieldView *view) {
+	const uint8_t *base = view->save + view->offsets->team_items;
+	info->team_size = field_team_size(view, 0);
+	memcpy(&info->pokemon, field_record_party(view, 0), 6 * PARTY_POKEMON_SIZE);
+	info->money = field_money(view, 0);
+	info->coins = field_coins(view, 0);
+
+	if (info->team_size > 6)
+		info->team_size = 6;
+
+	const uint8_t *team[6] = { 0 };
+	bool valid[6];
+	uint8_t levels[6] = { 0 };
+	struct Stats stats[6];
+	for (size_t i = 0; i < info->team_size; i++) {
+		team[i] = field_record_party(view, i);
+		levels[i] = team[i][PARTY_LEVEL];
+	}
+	check_pokemon(valid, team, info->team_size);
+	compute_stats(stats, team, levels, info->team_size);
+
+	for (size_t i = 0; i < info->team_size; i++) {
+		const uint8_t *pokemon = team[i];
+		enum {
+			NICKNAME = 8, // 10
+			PERSONALITY = 0, // 4
+			OT_ID = 4,   // 4
+			OT_NAME = 20, // 7
+			MARKINGS = 27, // 1
+			LEVEL = 84,   // 1
+			POKERUS = 85,  // 1
+			CURRENT_HP = 86, // 2
+			TOTAL_HP = 88,   // 2
+			ATTACK = 90,     // 2
+			DEFENSE = 92,    // 2
+			SPEED = 94,      // 2
+			SP_ATTACK = 96,  // 2
+			SP_DEFENSE = 98, // 2
+			TRICKY_DATA = 32,
+		};
+
+		memcpy(&info->pokemon[i].personality, pokemon + PERSONALITY, 4);
+		decode_text(info->pokemon[i].nickname, pokemon + NICKNAME, 10);
+		memcpy(&info->pokemon[i].ot_id, pokemon + OT_ID, 4);
+		decode_text(info->pokemon[i].ot_name, pokemon + OT_NAME, 7);
+		memcpy(&info->pokemon[i].level, pokemon + LEVEL, 1);
+		memcpy(&info->pokemon[i].current_hp, pokemon + CURRENT_HP, 2);
+		memcpy(&info->pokemon[i].total_hp, pokemon + TOTAL_HP, 2);
+		memcpy(&info->pokemon[i].attack, pokemon + ATTACK, 2);
+		memcpy(&info->pokemon[i].defense, pokemon + DEFENSE, 2);
+		memcpy(&info->pokemon[i].speed, pokemon + SPEED, 2);
+		memcpy(&info->pokemon[i].sp_attack, pokemon + SP_ATTACK, 2);
+		memcpy(&info->pokemon[i].sp_defense, pokemon + SP_DEFENSE, 2);
+		union PokemonData raw_data;
+		unshuffle_pokemon(&raw_data, pokemon);
+
+		memcpy(&info->pokemon[i].species, raw_data.data_g, 2);
+		info->pokemon[i].valid = valid[i] && species_info(info->pokemon[i].species);
+		info->pokemon[i].edited = info->pokemon[i].valid && memcmp(stats[i].stat, pokemon + PARTY_STATS, sizeof(stats[i].stat)) != 0;
+	}
+
+	decode_items(info->pockets, base, view->sec_key);
+}
+
+void dump_team_info(const struct TeamInfo *info) {
+	for (size_t i = 0; i < info->team_size; i++) {
+		const uint16_t species = info->pokemon[i].species;
+		if (!info->pokemon[i].valid) {
+			printf("bad egg (species %d, personality %d)\n", species, info->pokemon[i].personality);
+			continue;
+		}
+
+		printf("species %d (%04x), %s should be a %s order %d, personality %d\n", species, species, info->pokemon[i].nickname, species_info(species)->name, info->pokemon[i].personality % 24, info->pokemon[i].personality);
+		if (info->pokemon[i].edited)
+			printf("  stats don't match level %d, edited?\n", info->pokemon[i].level);
+	}
+
+	printf("money $%d\n", info->money);
+	printf("coins %d\n", info->coins);
+
+	for (int p = 0; p < POCKET_COUNT; p++) {
+		const struct Pocket *pocket = &info->pockets[p];
+		printf("%s: %d\n", pocket_names[p], pocket->count);
+		for (uint32_t i = 0; i < pocket->count; i++) {
+			printf("  item %d x%d\n", pocket->items[i].id, pocket->items[i].quantity);
+		}
+	}
+}
+
+// the generic walk over the table, same decoding as the accessors
+void dump_fields(const uint8_t *save, const struct SaveOffsets *offsets, const uint32_t sec_key) {
+	const struct FieldView view = { save, offsets, sec_key };
+
+	for (size_t f = 0; f < sizeof(save_fields) / sizeof(save_fields[0]); f++) {
+		const struct Field *field = &save_fields[f];
+		if (!field_present(&view, field->source) || (field->flags & FIELD_DECODED))
+			continue;
+
+		printf("%s:", field->name);
+		for (int i = 0; i < field->count; i++) {
+			if (field->encoding == TEXT) {
+				uint8_t text[256];
+				field_text(text, &view, field->source, field->offset, field->width, field->stride, i);
+				// blank entries are zero filled, which decodes to spaces
+				if ((field->flags & FIELD_SPARSE) && (text[0] == 0 || text[0] == ' '))
+					continue;
+				if (field->count > 1)
+					printf(" [%d]", i);
+				printf(" %s", text);
+				continue;
+			}
+
+			const uint32_t value = field_value(&view, field->source, field->offset, field->width, field->encoding,
+				field->shift, field->bits, field->stride, i);
+			if ((field->flags & FIELD_SPARSE) && value == 0)
+				continue;
+			if (field->count > 1)
+				printf(" [%d]", i);
+			if (field->encoding == SPECIES && species_info(value))
+				printf(" %s", species_info(value)->name);
+			else
+				printf(" %u", value);
+		}
+		printf("\n");
+	}
+}
+
+// everything decoded from one save. each task below fills in exactly one of
+// the result fields so tasks can run in any order, on any thread.
+enum {
+	TASK_TRAINER,
+	TASK_TEAM,
+	TASK_GAME_STATE,
+	TASK_PC_FIRST,
+	TASK_COUNT = TASK_PC_FIRST + 9
+};
+
+struct SaveDecode {
+	const uint8_t *save;
+	struct SaveOffsets offsets;
+	uint32_t sec_key;
+
+	struct TrainerInfo trainer;
+	struct TeamInfo team;
+	struct GameFlags flags;
+	struct PcSection pc[9];
+};
+
+void run_decode_task(struct SaveDecode *decode, const int task) {
+	const uint8_t *save = decode->save;
+	const struct SaveOffsets *offsets = &decode->offsets;
+	const struct FieldView view = { save, offsets, decode->sec_key };
+	switch (task) {
+		case TASK_TRAINER: decode_trainer_info(&decode->trainer, &view); break;
+		case TASK_TEAM: decode_team_info(&decode->team, &view); break;
+		case TASK_GAME_STATE: decode_game_flags(&decode->flags, &view); break;
+		default: decode_pc_section(&decode->pc[task - TASK_PC_FIRST], save, offsets, task - TASK_PC_FIRST); break;
+	}
+}
+
+void decode_save(struct SaveDecode *decode) {
+	for (int i = 0; i < TASK_COUNT; i++) {
+		run_decode_task(decode, i);
+	}
+}
+
+void dump_save(const struct SaveDecode *decode) {
+	dump_trainer_info(&decode->trainer);
+	dump_team_info(&decode->team);
+	dump_game_flags(&decode->flags);
+	dump_pc_info(decode->pc);
+	dump_fields(decode->save, &decode->offsets, decode->sec_key);
+}
+
+// returns NULL (after complaining) rather than exiting so batch runs can skip bad files
+const uint8_t *map_save(const char *file_name, size_t *size) {
+	struct stat s;
+
+	int fd = open(file_name, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "open %s failed: %s\n", file_name, strerror(errno));
+		return NULL;
+	}
+
+	int status = fstat(fd, &s);
+	if (status < 0) {
+		fprintf(stderr, "stat %s failed: %s\n", file_name, strerror(errno));
+		close(fd);
+		return NULL;
+	}
+	*size = s.st_size;
+
+	// mmap refuses a zero length. there is nothing to read in an empty file, so
+	// hand back something that isn't NULL and let validation call it too small.
+	if (*size == 0) {
+		static const uint8_t empty[1];
+		close(fd);
+		return empty;
+	}
+
+	const uint8_t *mapped = mmap(0, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) {
+		fprintf(stderr, "mmap %s failed: %s\n", file_name, strerror(errno));
+		return NULL;
+	}
+
+	return mapped;
+}
+
+void unmap_save(const uint8_t *mapped, const size_t size) {
+	if (size > 0)
+		munmap((void *)mapped, size);
+}
+
+// pack files hold many save images back to back, each page aligned so it can
+// be read straight out of one mapping of the whole pack. the index at
+// index_offset records where each image is along with the active slot and
+// section table, so reading an entry never has to scan its sections again.
+//
+// appending writes the new images after everything else, then a fresh copy of
+// the full index, and only then points the header at it. a pack is never left
+// with a header pointing at a half written index, at the cost of leaving the
+// old index behind as dead space.
+enum {
+	PACK_VERSION = 1,
+	PACK_ALIGN = 4096
+};
+
+static const char pack_magic[8] = { 'G', 'E', 'N', '3', 'P', 'A', 'C', 'K' };
+
+struct PackHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t count;
+	uint64_t index_offset;
+};
+
+struct PackEntry {
+	uint64_t offset;   // of the save image from the start of the pack
+	uint32_t size;     // of the save image
+	uint32_t slot;     // offset of the active slot inside the image
+	uint64_t hash;     // fnv-1a of the whole image
+	uint16_t sections[SECTION_COUNT]; // section offsets inside the slot, by section id
+	uint8_t reserved[4];
+};
+
+struct Pack {
+	const uint8_t *mapped;
+	size_t size;
+	const struct PackHeader *header;
+	const struct PackEntry *entries;
+};
+
+uint64_t fnv1a(const uint8_t *data, const size_t size) {
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= data[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+
+// peeks without mapping anything. unreadable files are left for the caller
+// to load and report the usual way.
+bool file_has_magic(const char *file_name, const char *magic) {
+	uint8_t found[sizeof(pack_magic)];
+	int fd = open(file_name, O_RDONLY);
+	if (fd < 0)
+		return false;
+	const bool match = pread(fd, found, sizeof(found), 0) == sizeof(found) && memcmp(found, magic, sizeof(found)) == 0;
+	close(fd);
+	return match;
+}
+
+// returns false if the file isn't a pack at all, exits if it is one but it's broken
+bool open_pack(struct Pack *pack, const char *file_name) {
+	memset(pack, 0, sizeof(*pack));
+	if (!file_has_magic(file_name, pack_magic))
+		return false;
+
+	const uint8_t *mapped = map_save(file_name, &pack->size);
+	check(mapped == NULL, "could not load %s", file_name);
+	check(pack->size < sizeof(struct PackHeader), "%s header is truncated", file_name);
+
+	const struct PackHeader *header = (const struct PackHeader *)mapped;
+	check(header->version != PACK_VERSION, "%s is pack version %d, expected %d", file_name, header->version, PACK_VERSION);
+	// an empty index takes no space, so packs written before the file was
+	// extended to cover it can point past their end
+	check(header->count > 0 && (header->index_offset > pack->size ||
+		(pack->size - header->index_offset) / sizeof(struct PackEntry) < header->count),
+		"%s index is truncated", file_name);
+
+	const struct PackEntry *entries = (const struct PackEntry *)(mapped + header->index_offset);
+	// entries were validated when they were packed, this just makes sure the
+	// index hasn't been damaged since so pack_save can trust it
+	for (uint32_t i = 0; i < header->count; i++) {
+		const struct PackEntry *entry = &entries[i];
+		check(entry->offset > pack->size || pack->size - entry->offset < entry->size,
+			"%s entry %d is out of bounds", file_name, i);
+		check(entry->size < SAVE_MIN_SIZE || (entry->slot != 0 && entry->slot != SAVE_SLOT_SIZE),
+			"%s entry %d has a bad slot", file_name, i);
+		for (int j = 0; j < SECTION_COUNT; j++) {
+			check(entry->sections[j] % SECTION_SIZE != 0 || entry->sections[j] >= SECTION_COUNT * SECTION_SIZE,
+				"%s entry %d has a bad section table", file_name, i);
+		}
+	}
+
+	pack->mapped = mapped;
+	pack->header = header;
+	pack->entries = entries;
+	return true;
+}
+
+void close_pack(struct Pack *pack) {
+	unmap_save(pack->mapped, pack->size);
+	memset(pack, 0, sizeof(*pack));
+}
+
+const uint8_t *pack_save(const struct Pack *pack, const uint32_t index, struct SaveOffsets *offsets) {
+	const struct PackEntry *entry = &pack->entries[index];
+	sections_to_offsets(offsets, entry->sections);
+	offsets->hall_of_fame = hall_of_fame_offset(entry->size, entry->slot);
+	return pack->mapped + entry->offset + entry->slot;
+}
+
+static void write_all(int fd, const void *data, size_t size, uint64_t offset, const char *file_name) {
+	const uint8_t *bytes = data;
+	while (size > 0) {
+		ssize_t written = pwrite(fd, bytes, size, offset);
+		check(written < 0, "write %s failed: %s", file_name, strerror(errno));
+		bytes += written;
+		offset += written;
+		size -= written;
+	}
+}
+
+int write_pack(const char *pack_name, char **files, const int file_count, const bool append) {
+	int fd = open(pack_name, append ? O_RDWR : O_RDWR | O_CREAT | O_TRUNC, 0644);
+	check(fd < 0, "open %s failed: %s", pack_name, strerror(errno));
+
+	struct PackHeader header;
+	struct PackEntry *entries = NULL;
+	uint64_t end = PACK_ALIGN;
+
+	if (append) {
+		struct Pack pack;
+		check(!open_pack(&pack, pack_name), "%s is not a pack", pack_name);
+		header = *pack.header;
+		entries = malloc((header.count + file_count) * sizeof(struct PackEntry));
+		check(entries == NULL, "out of memory");
+		memcpy(entries, pack.entries, header.count * sizeof(struct PackEntry));
+		end = pack.size;
+		close_pack(&pack);
+	}
+	else {
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, pack_magic, sizeof(pack_magic));
+		header.version = PACK_VERSION;
+		entries = malloc(file_count * sizeof(struct PackEntry));
+		check(entries == NULL, "out of memory");
+	}
+
+	int skipped = 0;
+	for (int i = 0; i < file_count; i++) {
+		size_t size;
+		const uint8_t *mapped = map_save(files[i], &size);
+		if (!mapped) {
+			skipped++;
+			continue;
+		}
+
+		struct SaveOffsets offsets;
+		const uint8_t *save;
+		bool slot_a;
+		enum save_error error = locate_save(mapped, size, &save, &offsets, &slot_a);
+		if (error != SAVE_OK) {
+			fprintf(stderr, "%s rejected: %s\n", files[i], save_error_names[error]);
+			unmap_save(mapped, size);
+			skipped++;
+			continue;
+		}
+
+		struct PackEntry *entry = &entries[header.count++];
+		memset(entry, 0, sizeof(*entry));
+		end = (end + PACK_ALIGN - 1) & ~(uint64_t)(PACK_ALIGN - 1);
+		entry->offset = end;
+		entry->size = size;
+		entry->slot = save - mapped;
+		entry->hash = fnv1a(mapped, size);
+		offsets_to_sections(entry->sections, &offsets);
+
+		write_all(fd, mapped, size, end, pack_name);
+		end += size;
+		unmap_save(mapped, size);
+	}
+
+	header.index_offset = (end + 7) & ~(uint64_t)7;
+	write_all(fd, entries, header.count * sizeof(struct PackEntry), header.index_offset, pack_name);
+	// nothing is written for an empty index, the file still has to reach it
+	const uint64_t index_end = header.index_offset + header.count * sizeof(struct PackEntry);
+	check(ftruncate(fd, index_end) < 0, "truncate %s failed: %s", pack_name, strerror(errno));
+	check(fsync(fd) < 0, "fsync %s failed: %s", pack_name, strerror(errno));
+	write_all(fd, &header, sizeof(header), 0, pack_name);
+	close(fd);
+	free(entries);
+
+	printf("%s: %d saves, %d skipped\n", pack_name, header.count, skipped);
+	return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int list_pack(const char *pack_name) {
+	struct Pack pack;
+	check(!open_pack(&pack, pack_name), "%s is not a pack", pack_name);
+
+	for (uint32_t i = 0; i < pack.header->count; i++) {
+		const struct PackEntry *entry = &pack.entries[i];
+		printf("%6d offset %10llu size %6d slot %c hash %016llx\n", i, (unsigned long long)entry->offset, entry->size,
+			entry->slot == 0 ? 'A' : 'B', (unsigned long long)entry->hash);
+	}
+
+	close_pack(&pack);
+	return EXIT_SUCCESS;
+}
+
+// batch runs split the file list between threads, each visiting saves into its
+// own partial result which the caller merges once everything has finished.
+struct BatchJob {
+	char **files;
+	int file_count;
+	const struct Pack *pack; // set by run_batch when the only file given is a pack
+	int thread_count;
+	size_t partial_size;
+	void (*visit)(void *partial, const uint8_t *save, const struct SaveOffsets *offsets);
+};
+
+struct BatchThread {
+	const struct BatchJob *job;
+	int index;
+	void *partial;
+	uint64_t skipped;
+	uint64_t rejected[SAVE_ERROR_COUNT];
+};
+
+static void *batch_thread(void *arg) {
+	struct BatchThread *thread = arg;
+	const struct BatchJob *job = thread->job;
+
+	if (job->pack) {
+		for (int i = thread->index; i < job->file_count; i += job->thread_count) {
+			struct SaveOffsets offsets;
+			const uint8_t *save = pack_save(job->pack, i, &offsets);
+			job->visit(thread->partial, save, &offsets);
+		}
+		return NULL;
+	}
+
+	for (int i = thread->index; i < job->file_count; i += job->thread_count) {
+		size_t size;
+		const uint8_t *mapped = map_save(job->files[i], &size);
+		if (!mapped) {
+			thread->skipped++;
+			continue;
+		}
+
+		struct SaveOffsets offsets;
+		const uint8_t *save;
+		bool slot_a;
+		enum save_error error = locate_save(mapped, size, &save, &offsets, &slot_a);
+		if (error != SAVE_OK) {
+			fprintf(stderr, "%s rejected: %s\n", job->files[i], save_error_names[error]);
+			thread->rejected[error]++;
+			thread->skipped++;
+		}
+		else {
+			job->visit(thread->partial, save, &offsets);
+		}
+
+		unmap_save(mapped, size);
+	}
+
+	return NULL;
+}
+
+int default_thread_count() {
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	return cpus > 0 ? (int)cpus : 1;
+}
+
+// returns thread_count partials, each partial_size rounded up to a cache line so
+// threads never write to the same line. caller frees.
+uint8_t *run_batch(struct BatchJob *job, size_t *stride, uint64_t *skipped) {
+	struct Pack pack;
+	bool is_pack = job->file_count == 1 && open_pack(&pack, job->files[0]);
+	if (is_pack) {
+		job->pack = &pack;
+		job->file_count = pack.header->count;
+	}
+
+	if (job->thread_count > job->file_count)
+		job->thread_count = job->file_count > 0 ? job->file_count : 1;
+
+	*stride = (job->partial_size + 63) & ~(size_t)63;
+	uint8_t *partials = aligned_alloc(64, *stride * job->thread_count);
+	check(partials == NULL, "out of memory allocating %d partial results", job->thread_count);
+	memset(partials, 0, *stride * job->thread_count);
+
+	pthread_t *threads = calloc(job->thread_count, sizeof(pthread_t));
+	struct BatchThread *state = calloc(job->thread_count, sizeof(struct BatchThread));
+	check(threads == NULL || state == NULL, "out of memory allocating %d threads", job->thread_count);
+
+	for (int i = 0; i < job->thread_count; i++) {
+		state[i].job = job;
+		state[i].index = i;
+		state[i].partial = partials + i * *stride;
+		int status = pthread_create(&threads[i], NULL, batch_thread, &state[i]);
+		check(status != 0, "pthread_create failed: %s", strerror(status));
+	}
+
+	*skipped = 0;
+	uint64_t rejected[SAVE_ERROR_COUNT] = { 0 };
+	for (int i = 0; i < job->thread_count; i++) {
+		pthread_join(threads[i], NULL);
+		*skipped += state[i].skipped;
+		for (int e = 0; e < SAVE_ERROR_COUNT; e++) {
+			rejected[e] += state[i].rejected[e];
+		}
+	}
+	for (int e = 0; e < SAVE_ERROR_COUNT; e++) {
+		if (rejected[e])
+			fprintf(stderr, "%llu rejected: %s\n", (unsigned long long)rejected[e], save_error_names[e]);
+	}
+
+	free(threads);
+	free(state);
+	if (is_pack) {
+		close_pack(&pack);
+		job->pack = NULL;
+	}
+
+	return partials;
+}
+
+// a small persistent pool for decoding a single save's sections in parallel.
+// workers only ever join a dispatch while holding the lock, and a dispatch
+// waits for the previous one to drain, so a late worker can't pick up tasks
+// from the next save with a stale decode pointer.
+struct TaskPool {
+	pthread_t *threads;
+	int thread_count;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	uint64_t generation;
+	bool quit;
+	struct SaveDecode *decode;
+	atomic_int next;
+	atomic_int done;
+	atomic_int active;
+};
+
+static void run_pool_tasks(struct TaskPool *pool, struct SaveDecode *decode) {
+	int task;
+	while ((task = atomic_fetch_add(&pool->next, 1)) < TASK_COUNT) {
+		run_decode_task(decode, task);
+		atomic_fetch_add(&pool->done, 1);
+	}
+}
+
+static void *pool_thread(void *arg) {
+	struct TaskPool *pool = arg;
+	uint64_t seen = 0;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		while (pool->generation == seen && !pool->quit) {
+			pthread_cond_wait(&pool->wake, &pool->lock);
+		}
+		if (pool->quit) {
+			pthread_mutex_unlock(&pool->lock);
+			return NULL;
+		}
+		seen = pool->generation;
+		struct SaveDecode *decode = pool->decode;
+		atomic_fetch_add(&pool->active, 1);
+		pthread_mutex_unlock(&pool->lock);
+
+		run_pool_tasks(pool, decode);
+		atomic_fetch_sub(&pool->active, 1);
+	}
+}
+
+// thread_count workers on top of the caller. zero is fine, the caller then
+// runs every task itself.
+void start_pool(struct TaskPool *pool, const int thread_count) {
+	memset(pool, 0, sizeof(*pool));
+	pool->thread_count = thread_count;
+	if (thread_count > 0) {
+		pool->threads = calloc(thread_count, sizeof(pthread_t));
+		check(pool->threads == NULL, "out of memory allocating %d threads", thread_count);
+	}
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	atomic_init(&pool->next, TASK_COUNT);
+	atomic_init(&pool->done, TASK_COUNT);
+	atomic_init(&pool->active, 0);
+
+	for (int i = 0; i < thread_count; i++) {
+		int status = pthread_create(&pool->threads[i], NULL, pool_thread, pool);
+		check(status != 0, "pthread_create failed: %s", strerror(status));
+	}
+}
+
+void stop_pool(struct TaskPool *pool) {
+	pthread_mutex_lock(&pool->lock);
+	pool->quit = true;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (int i = 0; i < pool->thread_count; i++) {
+		pthread_join(pool->threads[i], NULL);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->wake);
+	free(pool->threads);
+}
+
+// the calling thread works through tasks too rather than sitting idle
+void decode_save_parallel(struct TaskPool *pool, struct SaveDecode *decode) {
+	pthread_mutex_lock(&pool->lock);
+	while (atomic_load(&pool->active) != 0) {
+		// stragglers from the last dispatch have no work left, they're just leaving
+		sched_yield();
+	}
+	pool->decode = decode;
+	atomic_store(&pool->done, 0);
+	atomic_store(&pool->next, 0);
+	pool->generation++;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+
+	run_pool_tasks(pool, decode);
+	while (atomic_load(&pool->done) < TASK_COUNT) {
+		// the remaining tasks are already running on workers
+		sched_yield();
+	}
+}
+
+double now_us() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int run_tasks(const char *file_name, int thread_count) {
+	enum {
+		REPEATS = 1000
+	};
+
+	size_t size;
+	const uint8_t *mapped = map_save(file_name, &size);
+	check(mapped == NULL, "could not load %s", file_name);
+
+	struct SaveOffsets offsets;
+	const uint8_t *save;
+	bool slot_a;
+	enum save_error error = locate_save(mapped, size, &save, &offsets, &slot_a);
+	check(error != SAVE_OK, "%s rejected: %s", file_name, save_error_names[error]);
+
+	// validation on its own. summing all 14 sections is most of it, the
+	// price of picking the slot the game would pick.
+	double start = now_us();
+	for (int i = 0; i < REPEATS; i++) {
+		error |= locate_save(mapped, size, &save, &offsets, &slot_a);
+	}
+	const double validate_ns = (now_us() - start) * 1000 / REPEATS;
+	check(error != SAVE_OK, "%s rejected: %s", file_name, save_error_names[error]);
+
+	struct SaveDecode *serial = calloc(1, sizeof(struct SaveDecode));
+	struct SaveDecode *parallel = calloc(1, sizeof(struct SaveDecode));
+	check(serial == NULL || parallel == NULL, "out of memory");
+
+	// the worker threads plus the calling thread
+	struct TaskPool pool;
+	start_pool(&pool, thread_count - 1);
+
+	double serial_best = 1e30, parallel_best = 1e30;
+	double serial_total = 0, parallel_total = 0;
+	for (int i = 0; i < REPEATS; i++) {
+		start = now_us();
+		locate_save(mapped, size, &serial->save, &serial->offsets, &slot_a);
+		serial->sec_key = read_sec_key(serial->save, &serial->offsets);
+		decode_save(serial);
+		double elapsed = now_us() - start;
+		serial_total += elapsed;
+		if (elapsed < serial_best)
+			serial_best = elapsed;
+
+		start = now_us();
+		locate_save(mapped, size, &parallel->save, &parallel->offsets, &slot_a);
+		parallel->sec_key = read_sec_key(parallel->save, &parallel->offsets);
+		decode_save_parallel(&pool, parallel);
+		elapsed = now_us() - start;
+		parallel_total += elapsed;
+		if (elapsed < parallel_best)
+			parallel_best = elapsed;
+	}
+
+	stop_pool(&pool);
+
+	dump_save(parallel);
+	printf("\n%s\n", memcmp(serial, parallel, sizeof(struct SaveDecode)) == 0 ? "parallel matches serial" : "PARALLEL MISMATCH");
+	printf("validate %8.2f ns mean\n", validate_ns);
+	printf("serial   %8.2f us mean, %8.2f us best\n", serial_total / REPEATS, serial_best);
+	printf("parallel %8.2f us mean, %8.2f us best (%d threads)\n", parallel_total / REPEATS, parallel_best, pool.thread_count + 1);
+
+	free(serial);
+	free(parallel);
+	unmap_save(mapped, size);
+	return EXIT_SUCCESS;
+}
+
+struct DexStats {
+	uint64_t saves;
+	uint64_t owned_any[DEX_WORDS];
+	uint64_t owned_all[DEX_WORDS];
+	uint64_t seen_any[DEX_WORDS];
+	uint64_t seen_all[DEX_WORDS];
+	uint32_t owned_by[DEX_COUNT];         // saves owning each species
+	uint32_t completion[DEX_COUNT + 1];   // saves by number of species owned
+};
+
+static void visit_dex(void *partial, const uint8_t *save, const struct SaveOffsets *offsets) {
+	struct DexStats *stats = partial;
+	struct Pokedex dex;
+	const struct FieldView view = { save, offsets, 0 }; // nothing in the dex is keyed
+	decode_pokedex(&dex, &view);
+
+	if (stats->saves == 0) {
+		memcpy(stats->owned_all, dex.owned, sizeof(dex.owned));
+		memcpy(stats->seen_all, dex.seen, sizeof(dex.seen));
+	}
+	stats->saves++;
+
+	for (int i = 0; i < DEX_WORDS; i++) {
+		stats->owned_any[i] |= dex.owned[i];
+		stats->owned_all[i] &= dex.owned[i];
+		stats->seen_any[i] |= dex.seen[i];
+		stats->seen_all[i] &= dex.seen[i];
+
+		// only walk the set bits, most saves own a small slice of the dex
+		uint64_t bits = dex.owned[i];
+		while (bits) {
+			stats->owned_by[i * 64 + __builtin_ctzll(bits)]++;
+			bits &= bits - 1;
+		}
+	}
+
+	stats->completion[dex_popcount(dex.owned)]++;
+}
+
+static void merge_dex(struct DexStats *out, const struct DexStats *in) {
+	if (in->saves == 0)
+		return;
+
+	if (out->saves == 0) {
+		*out = *in;
+		return;
+	}
+
+	out->saves += in->saves;
+	for (int i = 0; i < DEX_WORDS; i++) {
+		out->owned_any[i] |= in->owned_any[i];
+		out->owned_all[i] &= in->owned_all[i];
+		out->seen_any[i] |= in->seen_any[i];
+		out->seen_all[i] &= in->seen_all[i];
+	}
+	for (int i = 0; i < DEX_COUNT; i++) {
+		out->owned_by[i] += in->owned_by[i];
+	}
+	for (int i = 0; i <= DEX_COUNT; i++) {
+		out->completion[i] += in->completion[i];
+	}
+}
+
+static const struct DexStats *rarest_stats;
+
+static int compare_rarest(const void *a, const void *b) {
+	const uint16_t lhs = *(const uint16_t *)a, rhs = *(const uint16_t *)b;
+	const uint32_t lhs_owned = rarest_stats->owned_by[lhs], rhs_owned = rarest_stats->owned_by[rhs];
+	if (lhs_owned != rhs_owned)
+		return lhs_owned < rhs_owned ? -1 : 1;
+	return lhs - rhs;
+}
+
+void dump_dex_stats(const struct DexStats *stats) {
+	enum {
+		BUCKET_WIDTH = 25,
+		RAREST_SHOWN = 20
+	};
+
+	printf("pokedex owned by every save %d, by any save %d\n", dex_popcount(stats->owned_all), dex_popcount(stats->owned_any));
+	printf("pokedex seen by every save %d, by any save %d\n", dex_popcount(stats->seen_all), dex_popcount(stats->seen_any));
+
+	printf("\ncompletion distribution (species owned)\n");
+	for (int lo = 0; lo <= DEX_COUNT; lo += BUCKET_WIDTH) {
+		int hi = lo + BUCKET_WIDTH - 1;
+		if (hi > DEX_COUNT)
+			hi = DEX_COUNT;
+		uint64_t saves = 0;
+		for (int i = lo; i <= hi; i++) {
+			saves += stats->completion[i];
+		}
+		if (saves)
+			printf("%3d - %3d: %llu\n", lo, hi, (unsigned long long)saves);
+	}
+
+	uint16_t order[DEX_COUNT];
+	for (int i = 0; i < DEX_COUNT; i++) {
+		order[i] = i;
+	}
+	rarest_stats = stats;
+	qsort(order, DEX_COUNT, sizeof(order[0]), compare_rarest);
+
+	printf("\nrarest owned\n");
+	for (int i = 0; i < RAREST_SHOWN; i++) {
+		const uint16_t dex = order[i] + 1;
+		const uint32_t owned = stats->owned_by[order[i]];
+		printf("#%03d %-12s %d (%.2f%%)\n", dex, pokemon_lut[national_to_species(dex)].name, owned, 100.0 * owned / stats->saves);
+	}
+}
+
+int run_dex_stats(char **files, int file_count, int thread_count) {
+	struct BatchJob job = {
+		.files = files,
+		.file_count = file_count,
+		.thread_count = thread_count,
+		.partial_size = sizeof(struct DexStats),
+		.visit = visit_dex
+	};
+
+	size_t stride;
+	uint64_t skipped;
+	uint8_t *partials = run_batch(&job, &stride, &skipped);
+
+	struct DexStats *stats = calloc(1, sizeof(struct DexStats));
+	check(stats == NULL, "out of memory");
+	for (int i = 0; i < job.thread_count; i++) {
+		merge_dex(stats, (const struct DexStats *)(partials + i * stride));
+	}
+	free(partials);
+
+	printf("%llu saves, %llu skipped\n", (unsigned long long)stats->saves, (unsigned long long)skipped);
+	if (stats->saves)
+		dump_dex_stats(stats);
+
+	free(stats);
+	return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+struct CheckStats {
+	uint64_t saves;
+	uint64_t saves_with_bad_eggs;
+	uint64_t pokemon;
+	uint64_t bad_eggs;
+	uint64_t bad_species;
+};
+
+static void visit_check(void *partial, const uint8_t *save, const struct SaveOffsets *offsets) {
+	struct CheckStats *stats = partial;
+	struct SavePokemon found;
+	collect_pokemon(&found, save, offsets);
+
+	// neither a bad checksum nor an unknown species makes it into records
+	const size_t bad_eggs = found.bad_checksums + found.bad_species;
+	stats->saves++;
+	stats->pokemon += found.count + bad_eggs;
+	stats->bad_eggs += bad_eggs;
+	stats->bad_species += found.bad_species;
+	stats->saves_with_bad_eggs += bad_eggs > 0;
+}
+
+int run_check(char **files, int file_count, int thread_count) {
+	struct BatchJob job = {
+		.files = files,
+		.file_count = file_count,
+		.thread_count = thread_count,
+		.partial_size = sizeof(struct CheckStats),
+		.visit = visit_check
+	};
+
+	size_t stride;
+	uint64_t skipped;
+	uint8_t *partials = run_batch(&job, &stride, &skipped);
+
+	struct CheckStats stats = { 0 };
+	for (int i = 0; i < job.thread_count; i++) {
+		const struct CheckStats *partial = (const struct CheckStats *)(partials + i * stride);
+		stats.saves += partial->saves;
+		stats.saves_with_bad_eggs += partial->saves_with_bad_eggs;
+		stats.pokemon += partial->pokemon;
+		stats.bad_eggs += partial->bad_eggs;
+		stats.bad_species += partial->bad_species;
+	}
+	free(partials);
+
+	printf("%llu saves, %llu skipped\n", (unsigned long long)stats.saves, (unsigned long long)skipped);
+	printf("%llu pokemon, %llu bad eggs (%llu with invalid species) in %llu saves\n",
+		(unsigned long long)stats.pokemon, (unsigned long long)stats.bad_eggs,
+		(unsigned long long)stats.bad_species, (unsigned long long)stats.saves_with_bad_eggs);
+
+	return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// .pk3 extraction. encrypted records are written straight out of the mapped
+// save with writev, only records that need decrypting or that straddle two
+// sections get copied, into an arena that's reused between flushes.
+enum {
+	EXTRACT_BATCH = 1024 // IOV_MAX on linux
+};
+
+// a record pack is a pack header with its own magic, the 80 byte records
+// back to back from PACK_ALIGN, then one index entry per record saying where
+// it came from. the header is written last, same as write_pack.
+static const char record_pack_magic[8] = { 'G', 'E', 'N', '3', 'P', 'K', '3', 'S' };
+
+struct RecordEntry {
+	uint32_t save;  // input file, or entry of an input pack
+	uint8_t box;    // 0 for the party, otherwise 1-14
+	uint8_t slot;   // 1-6 in the party, 1-30 in a box
+	uint8_t reserved[2];
+};
+
+struct Extract {
+	int fd;            // record pack, or -1
+	const char *dir;   // otherwise one .pk3 per pokemon in here
+	bool decrypt;
+	int count;
+	struct iovec iov[EXTRACT_BATCH];
+	struct RecordEntry where[EXTRACT_BATCH];
+	uint8_t arena[EXTRACT_BATCH][BOX_POKEMON_SIZE];
+	uint32_t save_index;
+	uint64_t written;
+	struct RecordEntry *index; // every record written so far, for the record pack
+	uint64_t index_capacity;
+};
+
+static void flush_extract(struct Extract *ex) {
+	if (ex->dir) {
+		for (int i = 0; i < ex->count; i++) {
+			const struct RecordEntry *where = &ex->where[i];
+			char path[PATH_MAX];
+			if (where->box == 0)
+				snprintf(path, sizeof(path), "%s/%06d-party-%d.pk3", ex->dir, where->save, where->slot);
+			else
+				snprintf(path, sizeof(path), "%s/%06d-box%02d-%02d.pk3", ex->dir, where->save, where->box, where->slot);
+			int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+			check(fd < 0, "open %s failed: %s", path, strerror(errno));
+			check(write(fd, ex->iov[i].iov_base, BOX_POKEMON_SIZE) != BOX_POKEMON_SIZE, "write %s failed: %s", path, strerror(errno));
+			close(fd);
+		}
+	}
+	else {
+		if (ex->written + ex->count > ex->index_capacity) {
+			ex->index_capacity = ex->index_capacity ? ex->index_capacity * 2 : EXTRACT_BATCH;
+			ex->index = realloc(ex->index, ex->index_capacity * sizeof(struct RecordEntry));
+			check(ex->index == NULL, "out of memory");
+		}
+		memcpy(ex->index + ex->written, ex->where, ex->count * sizeof(struct RecordEntry));
+
+		struct iovec *iov = ex->iov;
+		int remaining = ex->count;
+		while (remaining > 0) {
+			ssize_t written = writev(ex->fd, iov, remaining);
+			check(written < 0, "writev failed: %s", strerror(errno));
+			// skip whatever made it out, a short write can stop mid record
+			while (remaining > 0 && (size_t)written >= iov->iov_len) {
+				written -= iov->iov_len;
+				iov++;
+				remaining--;
+			}
+			if (remaining > 0) {
+				iov->iov_base = (uint8_t *)iov->iov_base + written;
+				iov->iov_len -= written;
+			}
+		}
+	}
+
+	ex->written += ex->count;
+	ex->count = 0;
+}
+
+// records are queued as pointers into the mapped save where possible, so the
+// caller has to flush before unmapping it
+static void extract_save(struct Extract *ex, const uint8_t *save, const struct SaveOffsets *offsets) {
+	struct SavePokemon found;
+	collect_pokemon(&found, save, offsets);
+	const size_t team_size = found.team_size;
+
+	const uint8_t *split_begin = found.pc.split[0];
+	const uint8_t *split_end = found.pc.split[PC_SPLIT_MAX];
+
+	for (size_t r = 0; r < found.count; r++) {
+		const struct PokemonRecord *source = &found.records[r];
+		const size_t i = source->index;
+
+		if (ex->count == EXTRACT_BATCH)
+			flush_extract(ex);
+
+		const uint8_t *record = source->pokemon;
+		if (ex->decrypt) {
+			memcpy(ex->arena[ex->count], record, 32);
+			memcpy(ex->arena[ex->count] + 32, source->raw_data.data, sizeof(source->raw_data.data));
+			record = ex->arena[ex->count];
+		}
+		else if (record >= split_begin && record < split_end) {
+			memcpy(ex->arena[ex->count], record, BOX_POKEMON_SIZE);
+			record = ex->arena[ex->count];
+		}
+
+		ex->iov[ex->count].iov_base = (void *)record;
+		ex->iov[ex->count].iov_len = BOX_POKEMON_SIZE;
+		struct RecordEntry *where = &ex->where[ex->count];
+		memset(where, 0, sizeof(*where));
+		where->save = ex->save_index;
+		if (i < team_size) {
+			where->slot = i + 1;
+		}
+		else {
+			where->box = (i - team_size) / BOX_SLOTS + 1;
+			where->slot = (i - team_size) % BOX_SLOTS + 1;
+		}
+		ex->count++;
+	}
+
+	ex->save_index++;
+}
+
+enum {
+	SPECIES_COUNT = sizeof(pokemon_lut) / sizeof(pokemon_lut[0]),
+	LEVEL_COUNT = 101
+};
+
+// levels come from experience, the same way for the party and the boxes.
+// eggs are counted as the egg entry and the egg type, and have no level.
+struct SpeciesStats {
+	uint64_t saves;
+	uint64_t pokemon;
+	uint64_t party[SPECIES_COUNT];
+	uint64_t box[SPECIES_COUNT];
+	uint64_t types[TYPE_COUNT];  // dual types count once towards each
+	uint64_t levels[LEVEL_COUNT];
+};
+
+static void visit_species(void *partial, const uint8_t *save, const struct SaveOffsets *offsets) {
+	struct SpeciesStats *stats = partial;
+	struct SavePokemon found;
+	collect_pokemon(&found, save, offsets);
+
+	for (size_t r = 0; r < found.count; r++) {
+		const struct PokemonRecord *record = &found.records[r];
+		const uint16_t species = record->egg ? SPECIES_EGG : record->species;
+		const struct Pokemon *poke = species_info(species);
+
+		stats->pokemon++;
+		stats->types[poke->type1]++;
+		if (poke->type2 != poke->type1)
+			stats->types[poke->type2]++;
+		if (!record->egg)
+			stats->levels[pokemon_level(&record->raw_data)]++;
+
+		if (record->index < found.team_size)
+			stats->party[species]++;
+		else
+			stats->box[species]++;
+	}
+
+	stats->saves++;
+}
+
+// compact json: only non-zero entries, species as [id, name, party, box]
+void dump_species_json(const struct SpeciesStats *stats, const uint64_t skipped) {
+	printf("{\"saves\":%llu,\"skipped\":%llu,\"pokemon\":%llu,\"species\":[",
+		(unsigned long long)stats->saves, (unsigned long long)skipped, (unsigned long long)stats->pokemon);
+	bool first = true;
+	for (int i = 0; i < SPECIES_COUNT; i++) {
+		if (!stats->party[i] && !stats->box[i])
+			continue;
+		printf("%s[%d,\"%s\",%llu,%llu]", first ? "" : ",", i, pokemon_lut[i].name,
+			(unsigned long long)stats->party[i], (unsigned long long)stats->box[i]);
+		first = false;
+	}
+
+	printf("],\"types\":{");
+	for (int i = 0; i < TYPE_COUNT; i++) {
+		printf("%s\"%s\":%llu", i ? "," : "", type_names[i], (unsigned long long)stats->types[i]);
+	}
+
+	printf("},\"levels\":[");
+	first = true;
+	for (int i = 0; i < LEVEL_COUNT; i++) {
+		if (!stats->levels[i])
+			continue;
+		printf("%s[%d,%llu]", first ? "" : ",", i, (unsigned long long)stats->levels[i]);
+		first = false;
+	}
+	printf("]}\n");
+}
+
+int run_species_stats(char **files, int file_count, int thread_count) {
+	struct BatchJob job = {
+		.files = files,
+		.file_count = file_count,
+		.thread_count = thread_count,
+		.partial_size = sizeof(struct SpeciesStats),
+		.visit = visit_species
+	};
+
+	size_t stride;
+	uint64_t skipped;
+	uint8_t *partials = run_batch(&job, &stride, &skipped);
+
+	// every counter is a uint64_t, so merging is one long add
+	struct SpeciesStats *stats = calloc(1, sizeof(struct SpeciesStats));
+	check(stats == NULL, "out of memory");
+	uint64_t *total = (uint64_t *)stats;
+	for (int t = 0; t < job.thread_count; t++) {
+		const uint64_t *partial = (const uint64_t *)(partials + t * stride);
+		for (size_t i = 0; i < sizeof(struct SpeciesStats) / sizeof(uint64_t); i++) {
+			total[i] += partial[i];
+		}
+	}
+	free(partials);
+
+	dump_species_json(stats, skipped);
+
+	free(stats);
+	return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// every pokemon at the level its experience gives. the party check uses the
+// stored level, since that's what the stored stats were calculated from.
+struct StatTotals {
+	uint64_t saves;
+	uint64_t pokemon;
+	uint64_t party;
+	uint64_t edited;
+	uint64_t edited_saves;
+	uint64_t count[SPECIES_COUNT];
+	uint64_t sum[SPECIES_COUNT][STAT_COUNT];
+};
+
+static void visit_stats(void *partial, const uint8_t *save, const struct SaveOffsets *offsets) {
+	struct StatTotals *totals = partial;
+	struct SavePokemon found;
+	collect_pokemon(&found, save, offsets);
+
+	// flat arrays for compute_stats so the batches stay full. eggs stay out
+	// of the species means but the game still stores stats for party eggs.
+	const uint8_t *present[ALL_POKEMON_MAX] = { 0 };
+	uint16_t species[ALL_POKEMON_MAX];
+	uint8_t levels[ALL_POKEMON_MAX] = { 0 };
+	const uint8_t *party[6] = { 0 };
+	uint8_t party_levels[6] = { 0 };
+	size_t n = 0, party_size = 0;
+	for (size_t r = 0; r < found.count; r++) {
+		const struct PokemonRecord *record = &found.records[r];
+		if (!record->egg) {
+			present[n] = record->pokemon;
+			species[n] = record->species;
+			levels[n] = pokemon_level(&record->raw_data);
+			n++;
+		}
+		if (record->index < found.team_size) {
+			party[party_size] = record->pokemon;
+			party_levels[party_size] = record->pokemon[PARTY_LEVEL];
+			party_size++;
+		}
+	}
+
+	struct Stats stats[ALL_POKEMON_MAX];
+	compute_stats(stats, present, levels, n);
+	for (size_t i = 0; i < n; i++) {
+		totals->count[species[i]]++;
+		for (int s = 0; s < STAT_COUNT; s++) {
+			totals->sum[species[i]][s] += stats[i].stat[s];
+		}
+	}
+
+	compute_stats(stats, party, party_levels, party_size);
+	uint64_t edited = 0;
+	for (size_t i = 0; i < party_size; i++) {
+		edited += memcmp(stats[i].stat, party[i] + PARTY_STATS, sizeof(stats[i].stat)) != 0;
+	}
+
+	totals->saves++;
+	totals->pokemon += n;
+	totals->party += party_size;
+	totals->edited += edited;
+	totals->edited_saves += edited > 0;
+}
+
+// compact json: species as [id, name, count, [mean stats]]
+void dump_stats_json(const struct StatTotals *totals, const uint64_t skipped) {
+	printf("{\"saves\":%llu,\"skipped\":%llu,\"pokemon\":%llu,\"party\":%llu,\"edited\":%llu,\"edited_saves\":%llu,\"stats\":[",
+		(unsigned long long)totals->saves, (unsigned long long)skipped, (unsigned long long)totals->pokemon,
+		(unsigned long long)totals->party, (unsigned long long)totals->edited,
+		(unsigned long long)totals->edited_saves);
+	for (int s = 0; s < STAT_COUNT; s++) {
+		printf("%s\"%s\"", s ? "," : "", stat_names[s]);
+	}
+
+	printf("],\"species\":[");
+	bool first = true;
+	for (int i = 0; i < SPECIES_COUNT; i++) {
+		const uint64_t count = totals->count[i];
+		if (!count)
+			continue;
+		printf("%s[%d,\"%s\",%llu,[", first ? "" : ",", i, pokemon_lut[i].name, (unsigned long long)count);
+		for (int s = 0; s < STAT_COUNT; s++) {
+			printf("%s%llu", s ? "," : "", (unsigned long long)(totals->sum[i][s] / count));
+		}
+		printf("]]");
+		first = false;
+	}
+	printf("]}\n");
+}
+
+int run_stats(char **files, int file_count, int thread_count) {
+	struct BatchJob job = {
+		.files = files,
+		.file_count = file_count,
+		.thread_count = thread_count,
+		.partial_size = sizeof(struct StatTotals),
+		.visit = visit_stats
+	};
+
+	size_t stride;
+	uint64_t skipped;
+	uint8_t *partials = run_batch(&job, &stride, &skipped);
+
+	struct StatTotals *totals = calloc(1, sizeof(struct StatTotals));
+	check(totals == NULL, "out of memory");
+	uint64_t *total = (uint64_t *)totals;
+	for (int t = 0; t < job.thread_count; t++) {
+		const uint64_t *partial = (const uint64_t *)(partials + t * stride);
+		for (size_t i = 0; i < sizeof(struct StatTotals) / sizeof(uint64_t); i++) {
+			total[i] += partial[i];
+		}
+	}
+	free(partials);
+
+	dump_stats_json(totals, skipped);
+
+	free(totals);
+	return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int run_extract(const char *out_name, char **files, const int file_count, const bool decrypt) {
+	struct Extract *ex = calloc(1, sizeof(struct Extract));
+	check(ex == NULL, "out of memory");
+	ex->decrypt = decrypt;
+	ex->fd = -1;
+
+	struct stat s;
+	if (stat(out_name, &s) == 0 && S_ISDIR(s.st_mode)) {
+		ex->dir = out_name;
+	}
+	else {
+		ex->fd = open(out_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		check(ex->fd < 0, "open %s failed: %s", out_name, strerror(errno));
+		check(lseek(ex->fd, PACK_ALIGN, SEEK_SET) < 0, "seek %s failed: %s", out_name, strerror(errno));
+	}
+
+	double start = now_us();
+	uint64_t skipped = 0;
+
+	struct Pack pack;
+	if (file_count == 1 && open_pack(&pack, files[0])) {
+		for (uint32_t i = 0; i < pack.header->count; i++) {
+			struct SaveOffsets offsets;
+			const uint8_t *save = pack_save(&pack, i, &offsets);
+			extract_save(ex, save, &offsets);
+		}
+		flush_extract(ex);
+		close_pack(&pack);
+	}
+	else {
+		for (int i = 0; i < file_count; i++) {
+			size_t size;
+			const uint8_t *mapped = map_save(files[i], &size);
+			if (!mapped) {
+				skipped++;
+				ex->save_index++;
+				continue;
+			}
+
+			struct SaveOffsets offsets;
+			const uint8_t *save;
+			bool slot_a;
+			enum save_error error = locate_save(mapped, size, &save, &offsets, &slot_a);
+			if (error != SAVE_OK) {
+				fprintf(stderr, "%s rejected: %s\n", files[i], save_error_names[error]);
+				skipped++;
+				ex->save_index++;
+			}
+			else {
+				extract_save(ex, save, &offsets);
+				flush_extract(ex);
+			}
+			unmap_save(mapped, size);
+		}
+	}
+
+	if (ex->fd >= 0) {
+		struct PackHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, record_pack_magic, sizeof(record_pack_magic));
+		header.version = PACK_VERSION;
+		header.count = ex->written;
+		header.index_offset = PACK_ALIGN + ex->written * BOX_POKEMON_SIZE;
+		write_all(ex->fd, ex->index, ex->written * sizeof(struct RecordEntry), header.index_offset, out_name);
+		const uint64_t index_end = header.index_offset + ex->written * sizeof(struct RecordEntry);
+		check(ftruncate(ex->fd, index_end) < 0, "truncate %s failed: %s", out_name, strerror(errno));
+		check(fsync(ex->fd) < 0, "fsync %s failed: %s", out_name, strerror(errno));
+		write_all(ex->fd, &header, sizeof(header), 0, out_name);
+		close(ex->fd);
+	}
+
+	double elapsed = (now_us() - start) / 1e6;
+	printf("%llu pokemon from %d saves (%llu skipped) in %.3fs, %.0f per minute\n",
+		(unsigned long long)ex->written, ex->save_index, (unsigned long long)skipped, elapsed,
+		elapsed > 0 ? ex->written / elapsed * 60 : 0.0);
+
+	free(ex->index);
+	free(ex);
+	return skipped ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+struct RecordPack {
+	const uint8_t *mapped;
+	size_t size;
+	const struct PackHeader *header;
+	const struct RecordEntry *entries;
+};
+
+// returns false if the file isn't a record pack, exits if it is one but it's broken
+bool open_record_pack(struct RecordPack *pack, const char *file_name) {
+	memset(pack, 0, sizeof(*pack));
+	if (!file_has_magic(file_name, record_pack_magic))
+		return false;
+
+	const uint8_t *mapped = map_save(file_name, &pack->size);
+	check(mapped == NULL, "could not load %s", file_name);
+	check(pack->size < sizeof(struct PackHeader), "%s header is truncated", file_name);
+
+	const struct PackHeader *header = (const struct PackHeader *)mapped;
+	check(header->version != PACK_VERSION, "%s is pack version %d, expected %d", file_name, header->version, PACK_VERSION);
+	check(header->index_offset != PACK_ALIGN + (uint64_t)header->count * BOX_POKEMON_SIZE,
+		"%s records don't end at the index", file_name);
+	check(header->count > 0 && (header->index_offset > pack->size ||
+		(pack->size - header->index_offset) / sizeof(struct RecordEntry) < header->count),
+		"%s index is truncated", file_name);
+
+	pack->mapped = mapped;
+	pack->header = header;
+	pack->entries = (const struct RecordEntry *)(mapped + header->index_offset);
+	return true;
+}
+
+int list_record_pack(const char *pack_name) {
+	struct RecordPack pack;
+	check(!open_record_pack(&pack, pack_name), "%s is not a record pack", pack_name);
+
+	for (uint32_t i = 0; i < pack.header->count; i++) {
+		const struct RecordEntry *entry = &pack.entries[i];
+		uint32_t personality;
+		memcpy(&personality, pack.mapped + PACK_ALIGN + (uint64_t)i * BOX_POKEMON_SIZE, 4);
+		if (entry->box == 0)
+			printf("%6d save %6d party    slot %2d personality %08x\n", i, entry->save, entry->slot, personality);
+		else
+			printf("%6d save %6d box %2d slot %2d personality %08x\n", i, entry->save, entry->box, entry->slot, personality);
+	}
+
+	unmap_save(pack.mapped, pack.size);
+	return EXIT_SUCCESS;
+}
+
+int read_pack_entry(const char *pack_name, const int index) {
+	struct Pack pack;
+	check(!open_pack(&pack, pack_name), "%s is not a pack", pack_name);
+	check(index < 0 || (uint32_t)index >= pack.header->count, "%s has no entry %d", pack_name, index);
+
+	struct SaveDecode *decode = calloc(1, sizeof(struct SaveDecode));
+	check(decode == NULL, "out of memory");
+	decode->save = pack_save(&pack, index, &decode->offsets);
+	decode->sec_key = read_sec_key(decode->save, &decode->offsets);
+
+	decode_save(decode);
+	dump_save(decode);
+
+	free(decode);
+	close_pack(&pack);
+	return EXIT_SUCCESS;
+}
+
+// live tracking reads a running emulator's copy of EWRAM through
+// /proc/pid/mem. these are emerald's addresses relative to 0x02000000.
+enum {
+	EWRAM_SIZE = 0x40000,
+	EWRAM_PARTY_COUNT = 0x244E9,  // 1
+	EWRAM_PARTY = 0x244EC,        // 600
+	EWRAM_PARTY_WINDOW = EWRAM_PARTY + 600 - EWRAM_PARTY_COUNT,
+	EWRAM_SAVEBLOCK2 = 0x24A54,
+	EWRAM_SAVEBLOCK1 = 0x25A00,
+	SAVEBLOCK_MOVE_RANGE = 128,   // both save blocks get moved by the same random offset
+	LIVE_HZ = 60
+};
+
+// a save block 2 starts with the player's name then gender, which is enough
+// to tell where the game has moved it to this time
+bool looks_like_saveblock2(const uint8_t *block) {
+	if (block[8] > 1 || poke_to_ascii(block[0]) == 0 || block[0] == 0)
+		return false;
+	for (int i = 1; i < 8; i++) {
+		if (block[i] == 0xFF)
+			return true;
+		if (poke_to_ascii(block[i]) == 0)
+			return false;
+	}
+	return false;
+}
+
+int find_saveblock_shift(int fd, const uint64_t ewram) {
+	uint8_t window[SAVEBLOCK_MOVE_RANGE + 9];
+	if (pread(fd, window, sizeof(window), ewram + EWRAM_SAVEBLOCK2) != sizeof(window))
+		return -1;
+	for (int shift = 0; shift < SAVEBLOCK_MOVE_RANGE; shift += 4) {
+		if (looks_like_saveblock2(window + shift))
+			return shift;
+	}
+	return -1;
+}
+
+bool party_window_valid(const uint8_t *window) {
+	const uint8_t count = window[0];
+	if (count < 1 || count > 6)
+		return false;
+
+	const uint8_t *team[6];
+	bool valid[6];
+	for (int i = 0; i < count; i++) {
+		team[i] = window + EWRAM_PARTY - EWRAM_PARTY_COUNT + i * PARTY_POKEMON_SIZE;
+	}
+	check_pokemon(valid, team, count);
+
+	// a bad egg in the party shouldn't stop us attaching, one real pokemon is enough
+	for (int i = 0; i < count; i++) {
+		if (!valid[i] || !pokemon_present(team[i]))
+			continue;
+		union PokemonData raw_data;
+		unshuffle_pokemon(&raw_data, team[i]);
+		uint16_t species;
+		memcpy(&species, raw_data.data_g, 2);
+		if (species != 0 && species_info(species))
+			return true;
+	}
+	return false;
+}
+
+// emulators either map EWRAM by itself or malloc it, which puts it a few
+// bytes into its own mapping. check the start of every big enough writable
+// mapping for something that looks like a party.
+uint64_t find_ewram(int fd, const int pid) {
+	enum {
+		SEARCH = 4096,
+		STEP = 16
+	};
+
+	char path[64];
+	snprintf(path, sizeof(path), "/proc/%d/maps", pid);
+	FILE *maps = fopen(path, "r");
+	check(maps == NULL, "open %s failed: %s", path, strerror(errno));
+
+	static uint8_t window[SEARCH + EWRAM_PARTY_WINDOW];
+	uint64_t found = 0;
+	char line[512];
+	while (!found && fgets(line, sizeof(line), maps)) {
+		unsigned long long start, end;
+		char perms[5];
+		if (sscanf(line, "%llx-%llx %4s", &start, &end, perms) != 3)
+			continue;
+		if (perms[0] != 'r' || perms[1] != 'w' || end - start < EWRAM_SIZE)
+			continue;
+
+		ssize_t got = pread(fd, window, sizeof(window), start + EWRAM_PARTY_COUNT);
+		if (got < EWRAM_PARTY_WINDOW)
+			continue;
+		for (ssize_t at = 0; at + EWRAM_PARTY_WINDOW <= got && start + at + EWRAM_SIZE <= end; at += STEP) {
+			if (party_window_valid(window + at)) {
+				found = start + at;
+				break;
+			}
+		}
+	}
+
+	fclose(maps);
+	return found;
+}
+
+// game text decodes to plain ascii, but that includes quotes
+void emit_json_string(const uint8_t *text) {
+	putchar('"');
+	for (; *text; text++) {
+		if (*text == '"' || *text == '\\')
+			putchar('\\');
+		if (*text < 0x20)
+			printf("\\u%04x", *text);
+		else
+			putchar(*text);
+	}
+	putchar('"');
+}
+
+void emit_party(const struct TeamInfo *info) {
+	printf("{\"money\":%u,\"party\":[", info->money);
+	for (size_t i = 0; i < info->team_size; i++) {
+		if (i)
+			printf(",");
+		if (!info->pokemon[i].valid) {
+			printf("{\"bad_egg\":true}");
+			continue;
+		}
+		printf("{\"species\":%d,\"name\":\"%s\",\"nickname\":", info->pokemon[i].species,
+			species_info(info->pokemon[i].species)->name);
+		emit_json_string(info->pokemon[i].nickname);
+		printf(",\"level\":%d,\"hp\":%d,\"max_hp\":%d}",
+			info->pokemon[i].level, info->pokemon[i].current_hp, info->pokemon[i].total_hp);
+	}
+	printf("]}\n");
+	fflush(stdout);
+}
+
+int run_live(const int pid, uint64_t ewram) {
+	char path[64];
+	snprintf(path, sizeof(path), "/proc/%d/mem", pid);
+	int fd = open(path, O_RDONLY);
+	check(fd < 0, "open %s failed: %s (is ptrace allowed?)", path, strerror(errno));
+
+	if (!ewram)
+		ewram = find_ewram(fd, pid);
+	check(ewram == 0, "couldn't find EWRAM with a valid party in process %d", pid);
+	fprintf(stderr, "EWRAM at %llx\n", (unsigned long long)ewram);
+
+	int shift = find_saveblock_shift(fd, ewram);
+
+	// the same layout as the team/items section, so a view with every offset at
+	// zero lets decode_team_info read it like a save
+	static uint8_t section[SECTION_SIZE];
+	uint8_t party[EWRAM_PARTY_WINDOW], last_party[EWRAM_PARTY_WINDOW];
+	uint32_t money = 0, key = 0, last_money = 0, last_key = 0;
+	bool first = true;
+
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (;;) {
+		if (pread(fd, party, sizeof(party), ewram + EWRAM_PARTY_COUNT) != sizeof(party))
+			break;
+
+		if (shift >= 0) {
+			uint8_t block[SAVEBLOCK2_KEY + 4];
+			if (pread(fd, block, sizeof(block), ewram + EWRAM_SAVEBLOCK2 + shift) != sizeof(block))
+				break;
+			if (!looks_like_saveblock2(block)) {
+				shift = find_saveblock_shift(fd, ewram);
+			}
+			else {
+				memcpy(&key, block + SAVEBLOCK2_KEY, 4);
+				if (pread(fd, &money, 4, ewram + EWRAM_SAVEBLOCK1 + shift + FIELD_OFFSET_money) != 4)
+					break;
+			}
+		}
+		else {
+			shift = find_saveblock_shift(fd, ewram);
+		}
+
+		if (first || memcmp(party, last_party, sizeof(party)) != 0 || money != last_money || key != last_key) {
+			const uint32_t team_size = party[0];
+			memcpy(section + FIELD_OFFSET_team_size, &team_size, 4);
+			memcpy(section + FIELD_OFFSET_party, party + EWRAM_PARTY - EWRAM_PARTY_COUNT, 6 * PARTY_POKEMON_SIZE);
+			memcpy(section + FIELD_OFFSET_money, &money, 4);
+
+			const struct SaveOffsets offsets = { 0 };
+			const struct FieldView view = { section, &offsets, key };
+			struct TeamInfo info;
+			decode_team_info(&info, &view);
+			emit_party(&info);
+
+			memcpy(last_party, party, sizeof(party));
+			last_money = money;
+			last_key = key;
+			first = false;
+		}
+
+		next.tv_nsec += 1000000000 / LIVE_HZ;
+		if (next.tv_nsec >= 1000000000) {
+			next.tv_nsec -= 1000000000;
+			next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+	}
+
+	fprintf(stderr, "process %d went away\n", pid);
+	close(fd);
+	return EXIT_SUCCESS;
+}
+
+// stand-in for an emulator: holds a save's party, money and trainer name in a
+// fake EWRAM laid out like the game's, then pokes at it once a second so the
+// live mode has something to notice.
+int run_fake_ewram(const char *file_name) {
+	size_t size;
+	const uint8_t *mapped = map_save(file_name, &size);
+	check(mapped == NULL, "could not load %s", file_name);
+
+	struct SaveOffsets offsets;
+	const uint8_t *save;
+	bool slot_a;
+	enum save_error error = locate_save(mapped, size, &save, &offsets, &slot_a);
+	check(error != SAVE_OK, "%s rejected: %s", file_name, save_error_names[error]);
+	const uint32_t sec_key = read_sec_key(save, &offsets);
+
+	uint8_t *ewram = mmap(0, EWRAM_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	check(ewram == MAP_FAILED, "mmap failed: %s", strerror(errno));
+
+	const int shift = 4 * (getpid() % (SAVEBLOCK_MOVE_RANGE / 4));
+	const struct FieldView view = { save, &offsets, sec_key };
+	const uint32_t team_size = field_team_size(&view, 0);
+	ewram[EWRAM_PARTY_COUNT] = team_size > 6 ? 6 : team_size;
+	memcpy(ewram + EWRAM_PARTY, field_record_party(&view, 0), 6 * PARTY_POKEMON_SIZE);
+
+	// the sections are the save blocks cut into pieces, put them back together
+	memcpy(ewram + EWRAM_SAVEBLOCK2 + shift, save + offsets.trainer_info, section_data_size[TRAINER_INFO]);
+	const size_t saveblock1[] = { offsets.team_items, offsets.game_state, offsets.misc_data, offsets.rival_info };
+	for (int i = 0; i < 4; i++) {
+		memcpy(ewram + EWRAM_SAVEBLOCK1 + shift + i * PC_SECTION_DATA, save + saveblock1[i], section_data_size[TEAM_ITEMS + i]);
+	}
+
+#ifdef PR_SET_PTRACER
+	// let non-root live mode read us even with yama's restricted ptrace
+	prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0);
+#endif
+
+	printf("pid %d, EWRAM at %p, save blocks moved by %d\n", getpid(), (void *)ewram, shift);
+	fflush(stdout);
+
+	for (uint32_t tick = 0;; tick++) {
+		sleep(1);
+		// the party's battle stats aren't covered by the checksum, so
+		// wobbling hp changes the bytes without making a bad egg
+		uint16_t hp;
+		memcpy(&hp, ewram + EWRAM_PARTY + 86, 2);
+		hp = tick & 1 ? hp + 1 : hp - 1;
+		memcpy(ewram + EWRAM_PARTY + 86, &hp, 2);
+
+		if (tick % 3 == 0) {
+			uint32_t money;
+			memcpy(&money, ewram + EWRAM_SAVEBLOCK1 + shift + FIELD_OFFSET_money, 4);
+			money = ((money ^ sec_key) + 100) ^ sec_key;
+			memcpy(ewram + EWRAM_SAVEBLOCK1 + shift + FIELD_OFFSET_money, &money, 4);
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// regression harness. the corpus is generated from a fixed seed rather than
+// checked in as binaries, so it is the same everywhere and reviewable. the
+// digest covers the decoded structures, not the printed text, so changes to
+// output formatting don't need a new golden value but changes to decoding do.
+enum {
+	SELFTEST_SAVES = 64,
+	SELFTEST_SAVE_SIZE = 0x20000,
+	SELFTEST_MUTATIONS = 20000,
+	SELFTEST_REGRESSION_PERCENT = 20
+};
+
+#define SELFTEST_DIGEST 0xc189d1f0bd56d63aull
+
+static uint64_t selftest_rand(uint64_t *state) {
+	// splitmix64
+	uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+	return z ^ (z >> 31);
+}
+
+// an 80 byte boxed pokemon with a working checksum, unless bad_egg. plain is
+// the decrypted substructures in GAEM order.
+static void seal_pokemon(uint8_t *out, uint64_t *rng, const uint32_t personality, const uint8_t *plain, const bool bad_egg) {
+	uint32_t ot_id = selftest_rand(rng);
+	memset(out, 0, BOX_POKEMON_SIZE);
+	memcpy(out, &personality, 4);
+	memcpy(out + 4, &ot_id, 4);
+	for (int i = 0; i < 10; i++) {
+		out[8 + i] = 0xBB + selftest_rand(rng) % 26;
+	}
+	out[20] = 0xBB;
+	out[21] = 0xFF;
+
+	// find where unshuffle_pokemon will look for each block by handing it a
+	// record whose key is zero and blocks are numbered
+	uint8_t probe[BOX_POKEMON_SIZE] = { 0 };
+	memcpy(probe, &personality, 4);
+	memcpy(probe + 4, &personality, 4);
+	for (int block = 0; block < 4; block++) {
+		memset(probe + 32 + block * 12, block, 12);
+	}
+	union PokemonData order;
+	unshuffle_pokemon(&order, probe);
+	const uint8_t position[4] = { order.data_g[0], order.data_a[0], order.data_e[0], order.data_m[0] };
+
+	uint8_t shuffled[48];
+	for (int block = 0; block < 4; block++) {
+		memcpy(shuffled + position[block] * 12, plain + block * 12, 12);
+	}
+
+	uint16_t checksum = 0;
+	for (int i = 0; i < 48; i += 2) {
+		checksum += plain[i] | plain[i + 1] << 8;
+	}
+	if (bad_egg)
+		checksum ^= 0x5A5A;
+	memcpy(out + POKEMON_CHECKSUM, &checksum, 2);
+
+	const uint32_t key = personality ^ ot_id;
+	for (int i = 0; i < 48; i += 4) {
+		uint32_t word;
+		memcpy(&word, shuffled + i, 4);
+		word ^= key;
+		memcpy(out + 32 + i, &word, 4);
+	}
+}
+
+static void make_pokemon(uint8_t *out, uint64_t *rng, const uint16_t species, const bool bad_egg) {
+	const uint32_t personality = selftest_rand(rng);
+	uint8_t plain[48];
+	for (int i = 0; i < 48; i++) {
+		plain[i] = selftest_rand(rng);
+	}
+	memcpy(plain, &species, 2);
+	// anywhere up to the top of the slowest curve
+	const uint32_t experience = selftest_rand(rng) % 1640001;
+	memcpy(plain + 4, &experience, 4);
+	seal_pokemon(out, rng, personality, plain, bad_egg);
+}
+
+// worked by hand from the formulas, not by running compute_stats. stats are
+// in stat_index order, so ivs and evs are too.
+struct KnownStats {
+	uint16_t species;
+	uint8_t nature;
+	uint32_t experience;
+	uint8_t level;
+	uint8_t iv[STAT_COUNT];
+	uint8_t ev[STAT_COUNT];
+	uint16_t stats[STAT_COUNT];
+};
+
+static const struct KnownStats known_stats[] = {
+	// mewtwo, slow, maxed out. modest lowers attack: 319 * 0.9 = 287.1
+	{ 150, 15, 1250000, 100, { 31, 31, 31, 31, 31, 31 }, { 252, 252, 252, 252, 252, 252 }, { 416, 287, 279, 359, 447, 279 } },
+	// shedinja, erratic, 1 hp whatever else. adamant lowers sp. attack: 50 * 0.9 = 45
+	{ 303, 3, 125000, 50, { 31, 31, 31, 31, 31, 31 }, { 0, 0, 0, 0, 0, 0 }, { 1, 121, 65, 60, 45, 50 } },
+	// pikachu, medium fast, freshly hatched
+	{ 25, 0, 125, 5, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }, { 18, 10, 8, 14, 10, 9 } },
+	// blissey, fast. distinct ivs catch packing mistakes, evs that aren't a
+	// multiple of 4 catch the rounding. bold lowers attack: 29 * 0.9 = 26.1
+	{ 242, 5, 800000, 100, { 1, 2, 3, 4, 5, 6 }, { 5, 9, 13, 17, 21, 25 }, { 622, 26, 34, 123, 165, 287 } },
+};
+
+enum {
+	KNOWN_STATS_COUNT = sizeof(known_stats) / sizeof(known_stats[0])
+};
+
+// a 100 byte party pokemon with its stored stats taken from the table
+static void make_known_pokemon(uint8_t *out, uint64_t *rng, const struct KnownStats *known, const bool bad_egg) {
+	const uint32_t personality = known->nature + NATURE_COUNT * (selftest_rand(rng) % (UINT32_MAX / NATURE_COUNT));
+	uint8_t plain[48] = { 0 };
+	memcpy(plain, &known->species, 2);
+	memcpy(plain + 4, &known->experience, 4);
+	memcpy(plain + 24, known->ev, STAT_COUNT);
+	uint32_t ivs = 0;
+	for (int s = 0; s < STAT_COUNT; s++) {
+		ivs |= (uint32_t)known->iv[s] << (s * 5);
+	}
+	memcpy(plain + 40, &ivs, 4);
+	seal_pokemon(out, rng, personality, plain, bad_egg);
+
+	out[PARTY_LEVEL] = known->level;
+	memcpy(out + 86, &known->stats[STAT_HP], 2);
+	memcpy(out + PARTY_STATS, known->stats, sizeof(known->stats));
+}
+
+// published thresholds for levels 2 and 100 on each curve
+static const uint32_t known_experience[][2] = {
+	[GROWTH_MEDIUM_FAST] = { 8, 1000000 },
+	[GROWTH_ERRATIC] = { 15, 600000 },
+	[GROWTH_FLUCTUATING] = { 4, 1640000 },
+	[GROWTH_MEDIUM_SLOW] = { 9, 1059860 },
+	[GROWTH_FAST] = { 6, 800000 },
+	[GROWTH_SLOW] = { 10, 1250000 },
+};
+
+static bool check_known_answers(void) {
+	bool ok = true;
+	for (int g = GROWTH_MEDIUM_FAST; g <= GROWTH_SLOW; g++) {
+		const uint32_t *at = known_experience[g];
+		if (level_from_experience(g, 0) != 1 || level_from_experience(g, at[0] - 1) != 1 ||
+			level_from_experience(g, at[0]) != 2 || level_from_experience(g, at[1] - 1) != 99 ||
+			level_from_experience(g, at[1]) != 100 || level_from_experience(g, UINT32_MAX) != 100) {
+			printf("growth rate %d disagrees with its published levels\n", g);
+			ok = false;
+		}
+	}
+
+	for (int k = 0; k < KNOWN_STATS_COUNT; k++) {
+		const struct KnownStats *known = &known_stats[k];
+		uint64_t rng = k;
+		uint8_t record[PARTY_POKEMON_SIZE] = { 0 };
+		make_known_pokemon(record, &rng, known, false);
+
+		union PokemonData raw_data;
+		unshuffle_pokemon(&raw_data, record);
+		const uint8_t level = pokemon_level(&raw_data);
+		struct Stats stats;
+		const uint8_t *pokemon = record;
+		compute_stats(&stats, &pokemon, &known->level, 1);
+		if (level != known->level || memcmp(stats.stat, known->stats, sizeof(stats.stat)) != 0) {
+			printf("%s level %d:", pokemon_lut[known->species].name, level);
+			for (int s = 0; s < STAT_COUNT; s++) {
+				printf(" %d", stats.stat[s]);
+			}
+			printf(", expected level %d:", known->level);
+			for (int s = 0; s < STAT_COUNT; s++) {
+				printf(" %d", known->stats[s]);
+			}
+			printf("\n");
+			ok = false;
+		}
+	}
+	if (ok)
+		printf("%d known stats ok\n", KNOWN_STATS_COUNT);
+	return ok;
+}
+
+static uint16_t random_species(uint64_t *rng) {
+	const uint32_t pick = selftest_rand(rng) % 386;
+	return national_to_species(pick + 1);
+}
+
+void make_synthetic_save(uint8_t *out, const uint32_t seed) {
+	uint64_t rng = seed * 0x2545F4914F6CDD1Dull + 1;
+	memset(out, 0, SELFTEST_SAVE_SIZE);
+
+	// the save blocks as they'd be in memory, then cut into sections below
+	static _Thread_local uint8_t sections[SECTION_COUNT][SECTION_SIZE];
+	static _Thread_local uint8_t pc[9 * PC_SECTION_DATA];
+	memset(sections, 0, sizeof(sections));
+	memset(pc, 0, sizeof(pc));
+
+	const uint32_t sec_key = selftest_rand(&rng);
+	uint8_t *trainer = sections[TRAINER_INFO];
+	for (int i = 0; i < 7; i++) {
+		trainer[i] = 0xBB + selftest_rand(&rng) % 26;
+	}
+	trainer[7] = 0xFF;
+	trainer[8] = seed & 1;
+	const uint32_t trainer_id = selftest_rand(&rng);
+	memcpy(trainer + 0xA, &trainer_id, 4);
+	for (int i = 0; i < DEX_BYTES; i++) {
+		const uint8_t owned = selftest_rand(&rng) & selftest_rand(&rng);
+		trainer[FIELD_OFFSET_dex_owned + i] = owned;
+		trainer[FIELD_OFFSET_dex_seen + i] = owned | selftest_rand(&rng);
+	}
+	memcpy(trainer + SAVEBLOCK2_KEY, &sec_key, 4);
+
+	uint8_t *team = sections[TEAM_ITEMS];
+	const uint32_t team_size = 1 + selftest_rand(&rng) % 6;
+	memcpy(team + FIELD_OFFSET_team_size, &team_size, 4);
+	// the party comes from the known answers so the stored stats are right
+	// without asking compute_stats what they should be
+	for (uint32_t i = 0; i < team_size; i++) {
+		uint8_t *pokemon = team + FIELD_OFFSET_party + i * PARTY_POKEMON_SIZE;
+		make_known_pokemon(pokemon, &rng, &known_stats[(seed + i) % KNOWN_STATS_COUNT], seed % 7 == 0 && i == 0);
+		if (seed % 11 == 0 && i == team_size - 1)
+			pokemon[PARTY_STATS + 2 * STAT_ATTACK]++;
+	}
+	const uint32_t money = (selftest_rand(&rng) % 1000000) ^ sec_key;
+	memcpy(team + FIELD_OFFSET_money, &money, 4);
+	for (int i = 0; i < 30; i++) {
+		const uint16_t id = i < 20 ? 1 + selftest_rand(&rng) % 376 : 0;
+		const uint16_t quantity = (1 + selftest_rand(&rng) % 99) ^ (i < 10 ? 0 : sec_key);
+		// first ten go in the pc, the rest in the bag
+		uint8_t *slot = team + (i < 10 ? 0x498 + i * 4 : 0x560 + (i - 10) * 4);
+		memcpy(slot, &id, 2);
+		memcpy(slot + 2, &quantity, 2);
+	}
+
+	for (int i = 0; i < 8; i++) {
+		const uint32_t flag = 0x867 + i;
+		if (selftest_rand(&rng) & 1)
+			sections[GAME_STATE][0x2f0 + (flag >> 3)] |= 1 << (flag & 7);
+	}
+
+	for (size_t i = 0; i < PC_POKEMON_COUNT; i++) {
+		if (selftest_rand(&rng) % 10 < 3)
+			make_pokemon(pc + PC_POKEMON + i * BOX_POKEMON_SIZE, &rng, random_species(&rng), seed % 5 == 0 && i == 7);
+	}
+	for (int box = 0; box < BOX_COUNT; box++) {
+		memset(pc + PC_BOX_NAMES + box * 9, 0xFF, 9);
+		pc[PC_BOX_NAMES + box * 9] = 0xBC + box;
+		pc[PC_WALLPAPERS + box] = box % 16;
+	}
+	for (int i = 0; i < 9; i++) {
+		memcpy(sections[PC_A + i], pc + i * PC_SECTION_DATA, PC_SECTION_DATA);
+	}
+
+	// slots rotate their sections, slot b is newer on odd seeds
+	const uint32_t rotation = seed % SECTION_COUNT;
+	for (int slot = 0; slot < 2; slot++) {
+		for (uint16_t i = 0; i < SECTION_COUNT; i++) {
+			uint8_t *section = out + slot * SAVE_SLOT_SIZE + i * SECTION_SIZE;
+			const uint16_t id = (i + rotation) % SECTION_COUNT;
+			memcpy(section, sections[id], PC_SECTION_DATA);
+			const uint16_t checksum = section_checksum(section, section_data_size[id]);
+			const uint32_t signature = 0x08012025;
+			const uint32_t index = seed & 1 ? 10 + slot : 20 - slot;
+			memcpy(section + 0xFF4, &id, 2);
+			memcpy(section + 0xFF6, &checksum, 2);
+			memcpy(section + 0xFF8, &signature, 4);
+			memcpy(section + 0xFFC, &index, 4);
+		}
+	}
+
+	for (int i = 0; i < 6 && seed % 3 == 0; i++) {
+		uint8_t *fame = out + HALL_OF_FAME_OFFSET + i * 20;
+		const uint16_t species_level = random_species(&rng) | (1 + selftest_rand(&rng) % 100) << 9;
+		memcpy(fame, &trainer_id, 4);
+		memcpy(fame + 8, &species_level, 2);
+		memset(fame + 10, 0xBB + i, 5);
+	}
+}
+
+static void digest_bytes(uint64_t *hash, const void *data, const size_t size) {
+	const uint8_t *bytes = data;
+	for (size_t i = 0; i < size; i++) {
+		*hash ^= bytes[i];
+		*hash *= 0x100000001b3ull;
+	}
+}
+
+#define DIGEST(hash, value) digest_bytes(hash, &(value), sizeof(value))
+
+// field by field so struct padding and never-written slots stay out of it
+void digest_save(uint64_t *hash, const struct SaveDecode *decode) {
+	DIGEST(hash, decode->sec_key);
+
+	const struct TrainerInfo *trainer = &decode->trainer;
+	digest_bytes(hash, trainer->name, sizeof(trainer->name));
+	DIGEST(hash, trainer->female);
+	DIGEST(hash, trainer->trainer_id);
+	digest_bytes(hash, &trainer->dex, sizeof(trainer->dex));
+
+	const struct TeamInfo *team = &decode->team;
+	DIGEST(hash, team->team_size);
+	for (size_t i = 0; i < team->team_size; i++) {
+		DIGEST(hash, team->pokemon[i].personality);
+		DIGEST(hash, team->pokemon[i].ot_id);
+		digest_bytes(hash, team->pokemon[i].nickname, sizeof(team->pokemon[i].nickname));
+		DIGEST(hash, team->pokemon[i].level);
+		DIGEST(hash, team->pokemon[i].current_hp);
+		DIGEST(hash, team->pokemon[i].total_hp);
+		DIGEST(hash, team->pokemon[i].species);
+		DIGEST(hash, team->pokemon[i].valid);
+		DIGEST(hash, team->pokemon[i].attack);
+		DIGEST(hash, team->pokemon[i].defense);
+		DIGEST(hash, team->pokemon[i].speed);
+		DIGEST(hash, team->pokemon[i].sp_attack);
+		DIGEST(hash, team->pokemon[i].sp_defense);
+		DIGEST(hash, team->pokemon[i].edited);
+	}
+	DIGEST(hash, team->money);
+	for (int p = 0; p < POCKET_COUNT; p++) {
+		DIGEST(hash, team->pockets[p].count);
+		digest_bytes(hash, team->pockets[p].items, team->pockets[p].count * sizeof(struct ItemSlot));
+	}
+
+	digest_bytes(hash, decode->flags.badges, sizeof(decode->flags.badges));
+
+	for (int s = 0; s < 9; s++) {
+		const struct PcSection *pc = &decode->pc[s];
+		DIGEST(hash, pc->first);
+		DIGEST(hash, pc->count);
+		for (size_t i = 0; i < pc->count; i++) {
+			DIGEST(hash, pc->pokemon[i].present);
+			if (!pc->pokemon[i].present)
+				continue;
+			DIGEST(hash, pc->pokemon[i].species);
+			DIGEST(hash, pc->pokemon[i].valid);
+			digest_bytes(hash, pc->pokemon[i].nickname, sizeof(pc->pokemon[i].nickname));
+		}
+	}
+
+	const struct FieldView view = { decode->save, &decode->offsets, decode->sec_key };
+	for (size_t f = 0; f < sizeof(save_fields) / sizeof(save_fields[0]); f++) {
+		const struct Field *field = &save_fields[f];
+		if (!field_present(&view, field->source))
+			continue;
+		for (int i = 0; i < field->count; i++) {
+			if (field->encoding == TEXT) {
+				uint8_t text[256];
+				field_text(text, &view, field->source, field->offset, field->width, field->stride, i);
+				digest_bytes(hash, text, field->width);
+			}
+			else {
+				const uint32_t value = field_value(&view, field->source, field->offset, field->width, field->encoding,
+					field->shift, field->bits, field->stride, i);
+				DIGEST(hash, value);
+			}
+		}
+	}
+}
+
+// the fast paths must agree with their scalar references on whatever they're
+// given, and the task graph must give the same result in any order. aborts
+// on a mismatch so a fuzzer reports it as a crash.
+void differential_check(const uint8_t *data, const size_t size) {
+	struct SaveOffsets offsets;
+	const uint8_t *save;
+	bool slot_a;
+	if (locate_save(data, size, &save, &offsets, &slot_a) != SAVE_OK)
+		return;
+
+	static _Thread_local struct SavePokemon found;
+	collect_pokemon(&found, save, &offsets);
+	bool scalar[ALL_POKEMON_MAX];
+	const size_t scalar_bad = check_pokemon_scalar(scalar, found.all, found.all_count);
+	if (found.bad_checksums != scalar_bad || memcmp(found.valid, scalar, found.all_count * sizeof(bool)) != 0) {
+		fprintf(stderr, "check_pokemon disagrees with check_pokemon_scalar\n");
+		abort();
+	}
+
+	// every slot, so garbage gets calculated too
+	uint8_t levels[ALL_POKEMON_MAX] = { 0 };
+	for (size_t i = 0; i < found.all_count; i++) {
+		union PokemonData raw_data;
+		unshuffle_pokemon(&raw_data, found.all[i]);
+		levels[i] = i < found.team_size ? found.all[i][PARTY_LEVEL] : pokemon_level(&raw_data);
+	}
+	struct Stats batched[ALL_POKEMON_MAX];
+	compute_stats(batched, found.all, levels, found.all_count);
+	for (size_t i = 0; i < found.all_count; i++) {
+		struct Stats single;
+		compute_stats(&single, found.all + i, levels + i, 1);
+		if (memcmp(&single, &batched[i], sizeof(single)) != 0) {
+			fprintf(stderr, "compute_stats depends on its batch\n");
+			abort();
+		}
+	}
+
+	for (int i = 0; i < SECTION_COUNT; i++) {
+		const uint8_t *section = save + i * SECTION_SIZE;
+		if (section_checksum(section, section_data_size[i]) != section_checksum_scalar(section, section_data_size[i])) {
+			fprintf(stderr, "section_checksum disagrees with section_checksum_scalar\n");
+			abort();
+		}
+	}
+
+	const uint16_t key = read_sec_key(save, &offsets);
+	struct ItemSlot fast_items[64], scalar_items[64];
+	for (size_t at = 0; at + 64 * 4 <= SECTION_SIZE; at += 64 * 4) {
+		unmask_items(fast_items, save + offsets.team_items + at, 64, key);
+		unmask_items_scalar(scalar_items, save + offsets.team_items + at, 64, key);
+		if (memcmp(fast_items, scalar_items, sizeof(fast_items)) != 0) {
+			fprintf(stderr, "unmask_items disagrees with unmask_items_scalar\n");
+			abort();
+		}
+	}
+
+	static _Thread_local struct SaveDecode forward, backward;
+	memset(&forward, 0, sizeof(forward));
+	memset(&backward, 0, sizeof(backward));
+	forward.save = backward.save = save;
+	forward.offsets = backward.offsets = offsets;
+	forward.sec_key = backward.sec_key = read_sec_key(save, &offsets);
+	decode_save(&forward);
+	for (int i = TASK_COUNT - 1; i >= 0; i--) {
+		run_decode_task(&backward, i);
+	}
+	if (memcmp(&forward, &backward, sizeof(forward)) != 0) {
+		fprintf(stderr, "decode tasks depend on their order\n");
+		abort();
+	}
+}
+
+#ifdef POKE_FUZZ
+// clang -g -O1 -fsanitize=fuzzer,address -DPOKE_FUZZ poke.c -o poke_fuzz
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	differential_check(data, size);
+	return 0;
+}
+#endif
+
+int run_selftest(const char *history_name) {
+	uint8_t *corpus = malloc(SELFTEST_SAVES * SELFTEST_SAVE_SIZE);
+	struct SaveDecode *decode = calloc(1, sizeof(struct SaveDecode));
+	check(corpus == NULL || decode == NULL, "out of memory");
+	for (int i = 0; i < SELFTEST_SAVES; i++) {
+		make_synthetic_save(corpus + i * SELFTEST_SAVE_SIZE, i);
+	}
+
+	bool ok = check_known_answers();
+	uint64_t digest = 0xcbf29ce484222325ull;
+	for (int i = 0; i < SELFTEST_SAVES; i++) {
+		const uint8_t *mapped = corpus + i * SELFTEST_SAVE_SIZE;
+		bool slot_a;
+		memset(decode, 0, sizeof(*decode));
+		enum save_error error = locate_save(mapped, SELFTEST_SAVE_SIZE, &decode->save, &decode->offsets, &slot_a);
+		if (error != SAVE_OK) {
+			printf("corpus save %d rejected: %s\n", i, save_error_names[error]);
+			ok = false;
+			continue;
+		}
+		decode->sec_key = read_sec_key(decode->save, &decode->offsets);
+		decode_save(decode);
+		digest_save(&digest, decode);
+		differential_check(mapped, SELFTEST_SAVE_SIZE);
+	}
+
+	if (digest != SELFTEST_DIGEST) {
+		printf("digest %016llx, expected %016llx\n", (unsigned long long)digest, (unsigned long long)SELFTEST_DIGEST);
+		ok = false;
+	}
+	else {
+		printf("digest %016llx ok\n", (unsigned long long)digest);
+	}
+
+	// mutated and truncated copies go through the same entry point a fuzzer
+	// would use. anything that gets past validation has to decode safely.
+	uint64_t rng = 1;
+	uint8_t *mutant = malloc(SELFTEST_SAVE_SIZE);
+	check(mutant == NULL, "out of memory");
+	for (int i = 0; i < SELFTEST_MUTATIONS; i++) {
+		memcpy(mutant, corpus + (i % SELFTEST_SAVES) * SELFTEST_SAVE_SIZE, SELFTEST_SAVE_SIZE);
+		const int flips = 1 + selftest_rand(&rng) % 64;
+		for (int f = 0; f < flips; f++) {
+			mutant[selftest_rand(&rng) % SELFTEST_SAVE_SIZE] ^= 1 << selftest_rand(&rng) % 8;
+		}
+		// validation checks section checksums, so most flips never get past it.
+		// every other round fixes them up to reach the decoders.
+		if (i & 1) {
+			for (size_t at = 0; at < 2 * SAVE_SLOT_SIZE; at += SECTION_SIZE) {
+				uint16_t id;
+				memcpy(&id, mutant + at + 0xFF4, 2);
+				if (id >= SECTION_COUNT)
+					continue;
+				const uint16_t checksum = section_checksum(mutant + at, section_data_size[id]);
+				memcpy(mutant + at + 0xFF6, &checksum, 2);
+			}
+		}
+		size_t size = SELFTEST_SAVE_SIZE;
+		if (i % 10 == 0)
+			size = selftest_rand(&rng) % SELFTEST_SAVE_SIZE;
+		differential_check(mutant, size);
+	}
+	printf("%d mutations ok\n", SELFTEST_MUTATIONS);
+	free(mutant);
+
+	// throughput of validate + full decode, one thread
+	uint64_t saves = 0;
+	const double start = now_us();
+	double elapsed;
+	do {
+		for (int i = 0; i < SELFTEST_SAVES; i++, saves++) {
+			bool slot_a;
+			locate_save(corpus + i * SELFTEST_SAVE_SIZE, SELFTEST_SAVE_SIZE, &decode->save, &decode->offsets, &slot_a);
+			decode->sec_key = read_sec_key(decode->save, &decode->offsets);
+			decode_save(decode);
+		}
+		elapsed = now_us() - start;
+	} while (elapsed < 500000);
+	const double rate = saves / (elapsed / 1e6);
+	printf("%.0f saves/sec\n", rate);
+
+	// history is one "saves/sec digest" line per run, compared against the best so far
+	if (history_name) {
+		double best = 0;
+		FILE *history = fopen(history_name, "r");
+		if (history) {
+			double recorded;
+			unsigned long long recorded_digest;
+			while (fscanf(history, "%lf %llx", &recorded, &recorded_digest) == 2) {
+				if (recorded > best)
+					best = recorded;
+			}
+			fclose(history);
+		}
+
+		if (best > 0 && rate < best * (100 - SELFTEST_REGRESSION_PERCENT) / 100) {
+			printf("throughput regressed: %.0f saves/sec against a best of %.0f\n", rate, best);
+			ok = false;
+		}
+
+		history = fopen(history_name, "a");
+		check(history == NULL, "open %s failed: %s", history_name, strerror(errno));
+		fprintf(history, "%.0f %016llx\n", rate, (unsigned long long)digest);
+		fclose(history);
+	}
+
+	free(corpus);
+	free(decode);
+	printf("%s\n", ok ? "selftest passed" : "selftest FAILED");
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#ifndef POKE_FUZZ
+static void usage() {
+	fprintf(stderr,
+		"usage: poke file.sav\n"
+		"       poke --dex [-j threads] files...\n"
+		"       poke --check [-j threads] files...\n"
+		"       poke --species [-j threads] files...\n"
+		"       poke --stats [-j threads] files...\n"
+		"       poke --tasks [-j threads] file.sav\n"
+		"       poke --pack-create file.pack files...\n"
+		"       poke --pack-append file.pack files...\n"
+		"       poke --pack-list file.pack|records.pk3s\n"
+		"       poke --pack-read file.pack index\n"
+		"       poke --extract out files...\n"
+		"       poke --extract-decrypted out files...\n"
+		"       poke --live pid [ewram address]\n"
+		"       poke --selftest [history file]\n"
+		"       poke --fake-ewram file.sav\n"
+		"extract writes one .pk3 per pokemon if out is a directory, otherwise a record pack: the 80 byte records and an index of which save, box and slot each came from, which --pack-list shows\n"
+		"batch modes accept a single pack in place of a list of saves\n");
+	exit(-1);
+}
+
+int main(int argc, char **argv) {
+	if (argc <= 1) {
+		fprintf(stderr, "provide a sav file please");
+		exit(-1);
+	}
+
+	if (strcmp(argv[1], "--selftest") == 0)
+		return run_selftest(argc > 2 ? argv[2] : NULL);
+
+	if (argv[1][0] == '-') {
+		const char *mode = argv[1];
+		int thread_count = default_thread_count();
+		int first = 2;
+		if (argc > 3 && strcmp(argv[2], "-j") == 0) {
+			thread_count = atoi(argv[3]);
+			check(thread_count <= 0, "bad thread count %s", argv[3]);
+			first = 4;
+		}
+		if (first >= argc)
+			usage();
+
+		if (strcmp(mode, "--dex") == 0)
+			return run_dex_stats(argv + first, argc - first, thread_count);
+		if (strcmp(mode, "--check") == 0)
+			return run_check(argv + first, argc - first, thread_count);
+		if (strcmp(mode, "--species") == 0)
+			return run_species_stats(argv + first, argc - first, thread_count);
+		if (strcmp(mode, "--stats") == 0)
+			return run_stats(argv + first, argc - first, thread_count);
+		if (strcmp(mode, "--pack-create") == 0 && argc - first >= 1)
+			return write_pack(argv[first], argv + first + 1, argc - first - 1, false);
+		if (strcmp(mode, "--pack-append") == 0 && argc - first >= 1)
+			return write_pack(argv[first], argv + first + 1, argc - first - 1, true);
+		if (strcmp(mode, "--pack-list") == 0)
+			return file_has_magic(argv[first], record_pack_magic) ? list_record_pack(argv[first]) : list_pack(argv[first]);
+		if (strcmp(mode, "--pack-read") == 0 && argc - first >= 2)
+			return read_pack_entry(argv[first], atoi(argv[first + 1]));
+		if (strcmp(mode, "--extract") == 0 && argc - first >= 2)
+			return run_extract(argv[first], argv + first + 1, argc - first - 1, false);
+		if (strcmp(mode, "--extract-decrypted") == 0 && argc - first >= 2)
+			return run_extract(argv[first], argv + first + 1, argc - first - 1, true);
+		if (strcmp(mode, "--live") == 0)
+			return run_live(atoi(argv[first]), first + 1 < argc ? strtoull(argv[first + 1], NULL, 16) : 0);
+		if (strcmp(mode, "--fake-ewram") == 0)
+			return run_fake_ewram(argv[first]);
+		if (strcmp(mode, "--tasks") == 0)
+			return run_tasks(argv[first], thread_count < TASK_COUNT ? thread_count : TASK_COUNT);
+
+		usage();
+	}
+
+	printf("loading %s\n", argv[1]);
+
+	const char *file_name = argv[1];
+	size_t size;
+	const uint8_t *mapped = map_save(file_name, &size);
+	check(mapped == NULL, "could not load %s", file_name);
+
+	struct SaveOffsets offsets;
+	const uint8_t *save;
+	bool slot_a;
+	enum save_error error = locate_save(mapped, size, &save, &offsets, &slot_a);
+	check(error != SAVE_OK, "%s rejected: %s", file_name, save_error_names[error]);
+	if (slot_a) {
+		printf("save A selected\n");
+	}
+	else {
+		printf("save B selected\n");
+	}
+
+	struct SaveDecode *decode = calloc(1, sizeof(struct SaveDecode));
+	check(decode == NULL, "out of memory");
+	decode->save = save;
+	decode->offsets = offsets;
+	decode->sec_key = read_sec_key(save, &offsets);
+
+	decode_save(decode);
+	dump_save(decode);
+
+	free(decode);
+	return 0;
+}
+#endif